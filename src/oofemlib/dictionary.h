@@ -36,48 +36,47 @@
 #define dictionr_h
 
 #include "oofemcfg.h"
-#include "pair.h"
 #include "error.h"
 #include "contextioresulttype.h"
 #include "contextmode.h"
 
 #include <string>
 #include <iosfwd>
+#include <vector>
+#include <utility>
 
 namespace oofem {
 class DataStream;
 
 /**
- * This class implements a linked list whose entries are Pairs (see below).
+ * This class implements a small map of integer keys to values.
  *
  * Dictionaries are typically used by degrees of freedom for storing their unknowns.
- * A dictionary stores its pairs in a linked list form. It knows the first
- * pair (attribute 'first') of the list. It also knows the last one (attribute
- * 'last') in order to append an additional pair fast.
+ * A dictionary only holds a few entries, so the key/value pairs are stored
+ * contiguously in insertion order and looked up by linear search. This avoids
+ * one heap allocation per entry and the pointer chasing of a linked list.
  */
 class OOFEM_EXPORT Dictionary
 {
 protected:
-    /// First pair
-    Pair *first;
-    /// Last pair
-    Pair *last;
+    /// Key/value pairs in insertion order.
+    std :: vector< std :: pair< int, double > >pairs;
 
 public:
     /// Constructor, creates empty dictionary
-    Dictionary() : first(NULL), last(NULL) { }
+    Dictionary() { }
     /// Destructor
-    ~Dictionary();
+    ~Dictionary() { }
 
     /// Clears the receiver.
     void clear();
     /**
-     * Adds a new Pair with given keyword and value into receiver.
+     * Adds a new pair with given keyword and value into receiver.
      * @param aKey key of new pair
      * @param value value of new pair
-     * @return New Pair with given keyword and value
+     * @return Reference to the value of the new pair.
      */
-    Pair *add(int aKey, double value);
+    double &add(int aKey, double value);
     /**
      * Returns the value of the pair which key is aKey.
      * If requested key doesn't exist, it is created with assigned value 0.
@@ -97,7 +96,7 @@ public:
     /// Formats itself as string.
     void formatAsString(std :: string &str);
     /// Returns number of pairs of receiver.
-    int giveSize();
+    int giveSize() const { return (int)pairs.size(); }
 
     /**
      * Saves the receiver contends (state) to given stream.
@@ -69,6 +69,7 @@
 #define _IFT_Domain_numberOfSpatialDimensions "nsd" ///< [in,optional] Specifies how many spatial dimensions the domain has.
 #define _IFT_Domain_nfracman "nfracman" /// [in,optional] Specifies if there is a fracture manager.
 #define _IFT_Domain_axisymmetric "axisymm" /// [optional] Specifies if the problem is axisymmetric.
+#define _IFT_Domain_cacheShapeDerivatives "cacheshapederivatives" /// [optional] Caches shape function derivatives in the integration points.
 //@}
 
 namespace oofem {
@@ -185,6 +186,13 @@ private:
      * because in case of multiple domains stateCounter should be kept independently for each domain.
      */
     StateCounterType nonlocalUpdateStateCounter;
+    /// If elements should cache shape function derivatives and jacobians in the integration points.
+    bool cacheShapeDerivatives;
+    /**
+     * Geometry state counter, incremented whenever node coordinates change.
+     * Geometry dependent data cached in integration points is only valid for the state it was computed in.
+     */
+    StateCounterType geometryStateCounter;
     /// XFEM Manager
     std :: unique_ptr< XfemManager > xfemManager;
 
@@ -703,6 +711,17 @@ public:
     /// sets the value of nonlocalUpdateStateCounter
     void setNonlocalUpdateStateCounter(StateCounterType val) { this->nonlocalUpdateStateCounter = val; }
 
+    /// Returns true if elements should cache shape function derivatives in the integration points.
+    bool giveCacheShapeDerivatives() const { return this->cacheShapeDerivatives; }
+    /// Sets if elements should cache shape function derivatives in the integration points.
+    void setCacheShapeDerivatives(bool val) { this->cacheShapeDerivatives = val; }
+    /// Returns the geometry state counter.
+    StateCounterType giveGeometryStateCounter() const { return this->geometryStateCounter; }
+    /// Marks that node coordinates have changed, invalidating all cached geometry dependent data.
+    void markGeometryChanged() { this->geometryStateCounter++; }
+    /// Returns the memory used by the cached shape function derivatives of all elements in bytes.
+    size_t giveShapeDerivativeCacheSize();
+
 private:
     void resolveDomainDofsDefaults(const char *);
 
@@ -78,11 +78,13 @@ class Node;
 class Material;
 class IntegrationRule;
 class GaussPoint;
+struct ShapeDerivativeCache;
 class FloatMatrix;
 class IntArray;
 class CrossSection;
 class ElementSide;
 class FEInterpolation;
+class FEICellGeometry;
 class Load;
 class BoundaryLoad;
 class BodyLoad;
@@ -516,6 +518,25 @@ public:
      * @return Volume for integration point.
      */
     virtual double computeVolumeAround(GaussPoint *gp) { return 0.; }
+    /**
+     * Computes the derivatives of the interpolation functions with respect to the global coordinates
+     * at the given integration point. If the domain caches shape function derivatives, the values are
+     * stored in the integration point and only recomputed when the geometry of the domain has changed.
+     * @param answer Derivatives of the interpolation functions.
+     * @param interp Interpolation to evaluate.
+     * @param gp Integration point.
+     * @param cellgeo Geometry of the element.
+     */
+    void computeDNdxAt(FloatMatrix &answer, FEInterpolation *interp, GaussPoint *gp, const FEICellGeometry &cellgeo);
+    /**
+     * Computes the determinant of the transformation jacobian at the given integration point.
+     * Uses the cached value in the same way as computeDNdxAt.
+     * @param interp Interpolation to evaluate.
+     * @param gp Integration point.
+     * @param cellgeo Geometry of the element.
+     * @return Determinant of the jacobian.
+     */
+    double computeTransformationJacobianAt(FEInterpolation *interp, GaussPoint *gp, const FEICellGeometry &cellgeo);
     /// Computes the volume, area or length of the element depending on its spatial dimension.
     virtual double computeVolumeAreaOrLength();
     /**
@@ -1160,6 +1181,11 @@ public:
      * @see IntegrationRule
      */
     virtual void computeGaussPoints() { }
+    /**
+     * Gives the shape function derivative cache of the given integration point, updated for the
+     * current geometry of the domain, or NULL if the domain does not cache shape function derivatives.
+     */
+    ShapeDerivativeCache *giveShapeDerivativeCache(FEInterpolation *interp, GaussPoint *gp, const FEICellGeometry &cellgeo);
 };
 
 template< class T > void
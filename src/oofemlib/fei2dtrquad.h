@@ -78,6 +78,7 @@ public:
     std::unique_ptr<IntegrationRule> giveIntegrationRule(int order) override;
 
     void evaldNdxi(FloatMatrix &answer, const FloatArray &lcoords, const FEICellGeometry &cellgeo) override;
+    bool hasReferenceTables() const override { return true; }
 
 protected:
     double edgeComputeLength(IntArray &edgeNodes, const FEICellGeometry &cellgeo);
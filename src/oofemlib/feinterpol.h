@@ -44,6 +44,11 @@
 #include "materialmode.h"
 #include "node.h"
 #include "element.h"
+#include "floatarray.h"
+#include "floatmatrix.h"
+
+#include <map>
+#include <vector>
 
 namespace oofem {
 class Element;
@@ -51,6 +56,7 @@ class FloatArray;
 class FloatMatrix;
 class IntArray;
 class IntegrationRule;
+class GaussPoint;
 
 template <std::size_t N> class FloatArrayF;
 template <std::size_t N, std::size_t M> class FloatMatrixF;
@@ -130,6 +136,21 @@ public:
     const FloatArray &giveVertexCoordinates(int i) const override { return this->coords [ i - 1 ]; }
 };
 
+/**
+ * Shape functions and their derivatives in the parent coordinate system, tabulated at the points of
+ * one Gauss rule. These values do not depend on the cell geometry and are shared by all elements using
+ * the same interpolation and rule.
+ */
+struct OOFEM_EXPORT FEIReferenceTable
+{
+    /// Local coordinates of the tabulated points.
+    std::vector<FloatArray> coords;
+    /// Shape functions at the points.
+    std::vector<FloatArray> N;
+    /// Derivatives of the shape functions with respect to the parent coordinates at the points.
+    std::vector<FloatMatrix> dNdxi;
+};
+
 /**
  * Class representing a general abstraction for finite element interpolation class.
  * The boundary functions denote the (numbered) region that have 1 spatial dimension (i.e. edges) or 2 spatial dimensions.
@@ -138,6 +159,8 @@ class OOFEM_EXPORT FEInterpolation
 {
 protected:
     int order;
+    /// Reference tables, indexed by integration domain and number of points of the rule.
+    std::map< std::pair< int, int >, FEIReferenceTable > referenceTables;
 
 public:
     FEInterpolation(int o) : order(o) { }
@@ -245,6 +268,44 @@ public:
     virtual std::unique_ptr<IntegrationRule> giveIntegrationRule(int order);
     //@}
 
+    /** @name Reference element tables.
+     * Interpolations with shape functions that do not depend on the cell geometry can tabulate N and dN/dxi
+     * once per Gauss rule, so that only the jacobian has to be evaluated for each element.
+     */
+    //@{
+    /**
+     * Returns true if evalN and evaldNdxi of the receiver do not depend on the cell geometry,
+     * so that their values can be tabulated on the reference element.
+     */
+    virtual bool hasReferenceTables() const { return false; }
+    /**
+     * Returns the reference table for the rule of given Gauss point, creating it on first use.
+     * @param gp Integration point.
+     * @return Table, or nullptr if the receiver or the rule of the point do not support tabulation.
+     */
+    const FEIReferenceTable *giveReferenceTable(GaussPoint *gp);
+    /**
+     * Evaluates the derivatives of shape functions in global coordinates from tabulated parent derivatives.
+     * @param answer Contains resulting matrix of derivatives.
+     * @param dNdxi Derivatives with respect to the parent coordinates.
+     * @param cellgeo Underlying cell geometry.
+     * @return Determinant of the Jacobian.
+     */
+    virtual double evaldNdxFromReference(FloatMatrix &answer, const FloatMatrix &dNdxi, const FEICellGeometry &cellgeo)
+    { OOFEM_ERROR("Not overloaded."); return 0.; }
+    /**
+     * Evaluates the derivatives of shape functions in global coordinates at given integration point,
+     * using the reference table when available.
+     * @see evaldNdx
+     */
+    double evaldNdxAt(FloatMatrix &answer, GaussPoint *gp, const FEICellGeometry &cellgeo);
+    /**
+     * Evaluates the shape functions at given integration point, using the reference table when available.
+     * @see evalN
+     */
+    void evalNAt(FloatArray &answer, GaussPoint *gp, const FEICellGeometry &cellgeo);
+    //@}
+
     /** @name Edge boundary functions.
      * Provide interpolation services for boundary edges (entity of dimension 1)
      */
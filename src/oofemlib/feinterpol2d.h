@@ -73,6 +73,7 @@ public:
     int global2local(FloatArray &answer, const FloatArray &gcoords, const FEICellGeometry &cellgeo) override;
 
     void giveJacobianMatrixAt(FloatMatrix &jacobianMatrix, const FloatArray &lcoords, const FEICellGeometry &cellgeo) override;
+    double evaldNdxFromReference(FloatMatrix &answer, const FloatMatrix &dNdxi, const FEICellGeometry &cellgeo) override;
 
     virtual bool inside(const FloatArray &lcoords) const;
 
@@ -54,6 +54,8 @@ public:
      */
     virtual double giveVolume(const FEICellGeometry &cellgeo) const;
 
+    double evaldNdxFromReference(FloatMatrix &answer, const FloatMatrix &dNdxi, const FEICellGeometry &cellgeo) override;
+
     void boundaryEdgeGiveNodes(IntArray &answer, int boundary) override;
     void boundaryEdgeEvalN(FloatArray &answer, int boundary, const FloatArray &lcoords, const FEICellGeometry &cellgeo) override;
     double boundaryEdgeGiveTransformationJacobian(int boundary, const FloatArray &lcoords, const FEICellGeometry &cellgeo) override;
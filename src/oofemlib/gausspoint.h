@@ -46,7 +46,9 @@
 #include "integrationpointstatus.h"
 #include "element.h"
 #include "floatarray.h"
+#include "floatmatrix.h"
 #include "materialmode.h"
+#include "statecountertype.h"
 
 namespace oofem {
 class Material;
@@ -55,6 +57,23 @@ class MicroplaneMaterial;
 class FiberedCrossSection;
 class CrossSection;
 class IntegrationRule;
+class FEInterpolation;
+
+/**
+ * Shape function derivatives and jacobian cached in an integration point.
+ * @see Element::computeDNdxAt
+ */
+struct ShapeDerivativeCache
+{
+    /// Interpolation the values belong to.
+    FEInterpolation *interp = nullptr;
+    /// Geometry state of the domain the values were computed for.
+    StateCounterType geometryState = 0;
+    /// Derivatives of the interpolation functions with respect to global coordinates.
+    FloatMatrix dNdx;
+    /// Determinant of the transformation jacobian.
+    double detJ = 0.;
+};
 
 /**
  * Class representing integration point in finite element program.
@@ -103,6 +122,8 @@ private:
     std::unique_ptr<FloatArray> subPatchCoordinates;
     /// Optional global (Cartesian) coordinates
     std::unique_ptr<FloatArray> globalCoordinates;
+    /// Optional cached shape function derivatives
+    std::unique_ptr<ShapeDerivativeCache> shapeDerivativeCache;
     /// Integration weight.
     double weight;
     /// Material mode of receiver.
@@ -135,7 +156,7 @@ public:
     double giveNaturalCoordinate(int i) const { return naturalCoordinates.at(i); }
     /// Returns coordinate array of receiver.
     const FloatArray &giveNaturalCoordinates() const { return naturalCoordinates; }
-    void setNaturalCoordinates(const FloatArray &c) { naturalCoordinates = c; }
+    void setNaturalCoordinates(const FloatArray &c) { naturalCoordinates = c; shapeDerivativeCache.reset(); }
 
     /// Returns local sub-patch coordinates of the receiver
     const FloatArray &giveSubPatchCoordinates() const
@@ -175,6 +196,24 @@ public:
         }
     }
 
+    /// Returns the cached shape function derivatives, or NULL if none have been stored.
+    ShapeDerivativeCache *giveShapeDerivativeCache() { return shapeDerivativeCache.get(); }
+    /// Creates an empty shape function derivative cache in receiver.
+    ShapeDerivativeCache *createShapeDerivativeCache()
+    {
+        shapeDerivativeCache = std::make_unique<ShapeDerivativeCache>();
+        return shapeDerivativeCache.get();
+    }
+    /// Returns the memory used by the cached shape function derivatives in bytes.
+    size_t giveShapeDerivativeCacheSize() const
+    {
+        if ( shapeDerivativeCache ) {
+            return sizeof(ShapeDerivativeCache) + shapeDerivativeCache->dNdx.giveNumberOfRows() *
+                   shapeDerivativeCache->dNdx.giveNumberOfColumns() * sizeof(double);
+        }
+        return 0;
+    }
+
     /// Returns  integration weight of receiver.
     double giveWeight() { return weight; }
     void setWeight(double w) { weight = w; }
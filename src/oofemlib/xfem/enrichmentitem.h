@@ -46,6 +46,7 @@
 
 #include <vector>
 #include <unordered_map>
+#include <set>
 
 ///@name Input fields for XFEM
 //@{
@@ -206,6 +207,19 @@ protected:
 public:
 
     virtual void createEnrichedDofs();
+    /**
+     * Creates and removes enriched dofs, but only in the given dof managers.
+     * Only valid if the dofs of all other dof managers are up to date.
+     * @param iDofManNumbers Dof managers to update.
+     */
+    virtual void createEnrichedDofs(const IntArray &iDofManNumbers);
+
+    /**
+     * Finds nodes with different enrichment in two node enrichment maps.
+     * @param oNodes Set where the changed nodes are inserted.
+     */
+    static void giveChangedNodes(std :: set< int > &oNodes, const std :: unordered_map< int, NodeEnrichmentType > &iOldMap,
+                                 const std :: unordered_map< int, NodeEnrichmentType > &iNewMap);
 
     // Return the coordinates of the tip in element iElIndex,
     // if the element contains a tip.
@@ -238,6 +252,13 @@ public:
     void setEnrichmentFunction(std::unique_ptr<EnrichmentFunction> ipEnrichmentFunc) { mpEnrichmentFunc = std::move(ipEnrichmentFunc); }
 
 protected:
+    /// Creates and removes the enriched dofs of a single dof manager.
+    void updateEnrichedDofs(DofManager &iDMan);
+    /**
+     * Updates the node enrichment markers and creates new dofs if necessary.
+     * With incremental XFEM updates, only dof managers with changed enrichment are visited.
+     */
+    void updateNodeEnrMarkerAndDofs(XfemManager &ixFemMan);
 
     std::unique_ptr<EnrichmentFunction> mpEnrichmentFunc;
 
@@ -45,6 +45,7 @@
 #include "internalstatevaluetype.h"
 
 #include <unordered_map>
+#include <set>
 #include <list>
 #include <vector>
 #include <memory>
@@ -62,6 +63,7 @@
 #define _IFT_XfemManager_enrDofScaleFac "enrdofscalefac"
 
 #define _IFT_XfemManager_debugVTK "debugvtk"
+#define _IFT_XfemManager_incrementalUpdate "incrementalupdate"
 #define _IFT_XfemManager_VTKExport "vtkexport"
 #define _IFT_XfemManager_VTKExportFields "exportfields"
 //@}
@@ -76,6 +78,7 @@ class Element;
 class DataStream;
 class DynamicInputRecord;
 class NucleationCriterion;
+class FloatArray;
 //class InternalStateValueType;
 
 //
@@ -159,6 +162,30 @@ protected:
     // IDs of all potential enriched dofs
     IntArray mXFEMPotentialDofIDs;
 
+    /**
+     * If true, only elements whose enrichment has changed since the last
+     * update get new integration rules, and the equation numbering is only
+     * recomputed if the enrichment of some node has changed.
+     */
+    bool mIncrementalUpdate;
+
+    /// Elements (place in array) that have been affected by changed enrichments.
+    std :: set< int >mDirtyElements;
+    /// If all elements should be treated as dirty, e.g. if the affected region could not be determined.
+    bool mAllElementsDirty;
+    /// Nodes whose enrichment has changed since the dirty elements were last cleared.
+    std :: set< int >mChangedNodes;
+    /// Node enrichment maps of all enrichment items at the last call to updateNodeEnrichmentItemMap.
+    std :: vector< std :: unordered_map< int, NodeEnrichmentType > >mPrevNodeEnrMarkerMaps;
+
+    /**
+     * Propagates the fronts of a single enrichment item. If incremental updates are active,
+     * the elements around the new front segments are marked as dirty.
+     */
+    void propagateEnrichmentItemFronts(EnrichmentItem &iEI, bool &oFrontsHavePropagated);
+    /// Gives the coordinates of the tips of an enrichment item, returns false if they are not available.
+    bool giveTipCoordinates(std :: vector< FloatArray > &oTips, EnrichmentItem &iEI) const;
+
 public:
 
     /**
@@ -245,6 +272,32 @@ public:
     void giveElementEnrichmentItemIndices(std :: vector< int > &oElemEnrInd, int iElementIndex) const;
 
     const std :: vector< int > &giveMaterialModifyingEnrItemIndices() const { return mMaterialModifyingEnrItemIndices; }
+
+    /// If only the elements affected by changed enrichments should be updated.
+    bool giveIncrementalUpdate() const { return mIncrementalUpdate; }
+    /**
+     * Checks if the enrichment of an element has changed since the dirty elements were last cleared.
+     * Always true if incremental updates are not used.
+     * @param iElementIndex Place of the element in the domain element array.
+     */
+    bool isElementDirty(int iElementIndex) const;
+    /// True if the enrichment of some node has changed, i.e. if the equation numbering needs to be updated.
+    bool hasNodeEnrichmentChanged() const { return mAllElementsDirty || !mChangedNodes.empty(); }
+    /// Gives the nodes whose enrichment has changed since the dirty elements were last cleared.
+    void giveChangedNodes(IntArray &oNodes) const;
+    /// True if the affected region is unknown and all elements must be updated.
+    bool areAllElementsDirty() const { return mAllElementsDirty; }
+    /// Marks all elements in the neighbourhood of the given nodes as dirty.
+    void markNodeNeighboursDirty(const IntArray &iNodes);
+    /**
+     * Marks all elements whose bounding box is intersected by the segment between
+     * the given points as dirty, together with their neighbours.
+     */
+    void markSegmentDirty(const FloatArray &iStart, const FloatArray &iEnd);
+    /// Marks all elements as dirty.
+    void markAllElementsDirty() { mAllElementsDirty = true; }
+    /// Clears the dirty state, should be called when all dirty elements have been updated.
+    void clearDirtyElements();
 };
 } // end namespace oofem
 #endif // xfemmanager_h
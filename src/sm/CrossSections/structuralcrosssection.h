@@ -108,6 +108,16 @@ public:
     virtual void giveRealStress_Warping(FloatArray &answer, GaussPoint *gp, const FloatArray &reducedStrain, TimeStep *tStep) = 0;
     //@}
 
+    /**
+     * Computes the real stresses for a batch of integration points in 3d mode.
+     * Default implementation calls giveRealStress_3d for each point.
+     * @param answer Stress vectors, one column per integration point (empty if any stress is empty).
+     * @param gps Integration points of one element.
+     * @param strains Strain vectors, one column per integration point.
+     * @param tStep Current time step.
+     */
+    virtual void giveRealStresses_3d(FloatMatrix &answer, const std :: vector< GaussPoint * > &gps, const FloatMatrix &strains, TimeStep *tStep);
+
     /**
      * Method for computing the stiffness matrix.
      * @param answer Stiffness matrix.
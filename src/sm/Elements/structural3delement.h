@@ -78,6 +78,7 @@ public:
 
     void giveMaterialOrientationAt(FloatArray &x, FloatArray &y, FloatArray &z, const FloatArray &lcoords);
     void computeStressVector(FloatArray &answer, const FloatArray &strain, GaussPoint *gp, TimeStep *tStep) override;
+    void computeStressVectors(FloatMatrix &answer, const FloatMatrix &strains, const std :: vector< GaussPoint * > &gps, TimeStep *tStep) override;
     void computeConstitutiveMatrixAt(FloatMatrix &answer, MatResponseMode rMode, GaussPoint *gp, TimeStep *tStep) override;
     void computeInitialStressMatrix(FloatMatrix &answer, TimeStep *tStep) override;
 
@@ -43,6 +43,7 @@
 #include "floatarray.h"
 
 #include <memory>
+#include <vector>
 
 namespace oofem {
 #define ALL_STRAINS -1
@@ -463,6 +464,15 @@ public:
      * @param tStep Time step.
      */
     virtual void computeStressVector(FloatArray &answer, const FloatArray &strain, GaussPoint *gp, TimeStep *tStep) = 0;
+    /**
+     * Computes the stress vectors of receiver for a batch of integration points, at time step tStep.
+     * Default implementation calls computeStressVector for each point.
+     * @param answer Stress vectors, one column per integration point (empty if any stress is empty).
+     * @param strains Strain vectors, one column per integration point.
+     * @param gps Integration points.
+     * @param tStep Time step.
+     */
+    virtual void computeStressVectors(FloatMatrix &answer, const FloatMatrix &strains, const std :: vector< GaussPoint * > &gps, TimeStep *tStep);
 
     /**
      * Computes the geometrical matrix of receiver in given integration point.
@@ -41,6 +41,7 @@ class TimeStep;
 class StructuralEngngModel;
 class StaticStructural;
 class FloatArray;
+class Domain;
 
 /**
  * Provides extra solver functionality needed for XFEM.
@@ -55,6 +56,12 @@ public:
 
 protected:
     bool mNeedsVariableMapping;
+
+    /**
+     * Updates dof managers, elements and boundary conditions affected by changed node
+     * enrichments when incremental XFEM updates are used.
+     */
+    void updateDirtyRegion(Domain &iDomain);
 };
 
 } /* namespace oofem */
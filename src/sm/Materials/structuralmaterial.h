@@ -173,6 +173,16 @@ public:
                                       const FloatArray &reducedStrain, TimeStep *tStep);
     /// Default implementation relies on giveRealStressVector for second Piola-Kirchoff stress
     virtual void giveRealStressVector_3d(FloatArray &answer, GaussPoint *gp, const FloatArray &reducedE, TimeStep *tStep);
+    /**
+     * Computes the real stress vectors for a batch of integration points in 3d mode.
+     * Models with a cheap closed form update can overload this to process all points at once.
+     * Default implementation calls giveRealStressVector_3d for each point.
+     * @param answer Stress vectors, one column per integration point (empty if any stress is empty).
+     * @param gps Integration points, all belonging to the receiver.
+     * @param strains Strain vectors, one column per integration point.
+     * @param tStep Current time step.
+     */
+    virtual void giveRealStressVectors_3d(FloatMatrix &answer, const std :: vector< GaussPoint * > &gps, const FloatMatrix &strains, TimeStep *tStep);
     /// Default implementation relies on giveRealStressVector_3d
     virtual void giveRealStressVector_PlaneStrain(FloatArray &answer, GaussPoint *gp, const FloatArray &reducedE, TimeStep *tStep);
     /// Iteratively calls giveRealStressVector_3d to find the stress controlled equal to zero·
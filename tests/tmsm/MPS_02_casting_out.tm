@@ -0,0 +1,2673 @@
+############################################################## www.oofem.org ###
+       ####    ####   ######  ######  #    #
+     #    #  #    #  #       #       ##  ##
+    #    #  #    #  #####   #####   # ## #
+   #    #  #    #  #       #       #    #
+  #    #  #    #  #       #       #    #   OOFEM ver. 2.6
+  ####    ####   #       ######  #    #    Copyright (C) 1994-2017 Borek Patzak
+################################################################################
+
+
+Starting analysis on: Sun Oct 18 13:04:01 2026
+
+element 1 constant rh = 0.98, element 2 constant rh = 0.5, remaining elements drying from rh = 0.98 to 0.5, drying starts at 14 days
+
+==============================================================
+Output for time 0.00000000e+00 
+==============================================================
+Output for domain   1
+
+
+DofManager output:
+------------------
+Node           1 (       1):
+  dof 14   d  9.80000000e-01
+Node           2 (       2):
+  dof 14   d  9.80000000e-01
+Node           3 (       3):
+  dof 14   d  9.80000000e-01
+Node           4 (       4):
+  dof 14   d  9.80000000e-01
+Node           5 (       5):
+  dof 14   d  5.00000000e-01
+Node           6 (       6):
+  dof 14   d  5.00000000e-01
+Node           7 (       7):
+  dof 14   d  5.00000000e-01
+Node           8 (       8):
+  dof 14   d  5.00000000e-01
+Node           9 (       9):
+  dof 14   d  9.80000000e-01
+Node          10 (      10):
+  dof 14   d  9.80000000e-01
+Node          11 (      11):
+  dof 14   d  9.80000000e-01
+Node          12 (      12):
+  dof 14   d  9.80000000e-01
+Node          13 (      13):
+  dof 14   d  9.80000000e-01
+Node          14 (      14):
+  dof 14   d  9.80000000e-01
+Node          15 (      15):
+  dof 14   d  9.80000000e-01
+Node          16 (      16):
+  dof 14   d  9.80000000e-01
+Node          17 (      17):
+  dof 14   d  9.80000000e-01
+Node          18 (      18):
+  dof 14   d  9.80000000e-01
+Node          19 (      19):
+  dof 14   d  9.80000000e-01
+Node          20 (      20):
+  dof 14   d  9.80000000e-01
+Node          21 (      21):
+  dof 14   d  9.80000000e-01
+Node          22 (      22):
+  dof 14   d  9.80000000e-01
+Node          23 (      23):
+  dof 14   d  9.80000000e-01
+Node          24 (      24):
+  dof 14   d  9.80000000e-01
+
+
+
+
+Element output:
+---------------
+element 1 (       1) :
+  GP  1.1  :  state 9.8000e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+  GP  1.2  :  state 9.8000e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+  GP  1.3  :  state 9.8000e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+  GP  1.4  :  state 9.8000e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+element 2 (       2) :
+  GP  1.1  :  state 5.0000e-01   flow -0.0000e+00 2.2204e-21 -0.0000e+00
+  GP  1.2  :  state 5.0000e-01   flow -0.0000e+00 2.2204e-21 -0.0000e+00
+  GP  1.3  :  state 5.0000e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 5.0000e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+element 3 (       3) :
+  GP  1.1  :  state 9.8000e-01   flow -0.0000e+00 -4.4409e-21 -0.0000e+00
+  GP  1.2  :  state 9.8000e-01   flow -0.0000e+00 -4.4409e-21 -0.0000e+00
+  GP  1.3  :  state 9.8000e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+  GP  1.4  :  state 9.8000e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+element 4 (       4) :
+  GP  1.1  :  state 9.8000e-01   flow -0.0000e+00 8.8818e-21 -0.0000e+00
+  GP  1.2  :  state 9.8000e-01   flow -0.0000e+00 8.8818e-21 -0.0000e+00
+  GP  1.3  :  state 9.8000e-01   flow -0.0000e+00 8.8818e-21 -0.0000e+00
+  GP  1.4  :  state 9.8000e-01   flow -0.0000e+00 8.8818e-21 -0.0000e+00
+element 5 (       5) :
+  GP  1.1  :  state 9.8000e-01   flow -0.0000e+00 -4.4409e-21 -0.0000e+00
+  GP  1.2  :  state 9.8000e-01   flow -0.0000e+00 -4.4409e-21 -0.0000e+00
+  GP  1.3  :  state 9.8000e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+  GP  1.4  :  state 9.8000e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+element 6 (       6) :
+  GP  1.1  :  state 9.8000e-01   flow -0.0000e+00 4.4409e-21 -0.0000e+00
+  GP  1.2  :  state 9.8000e-01   flow -0.0000e+00 4.4409e-21 -0.0000e+00
+  GP  1.3  :  state 9.8000e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+  GP  1.4  :  state 9.8000e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+
+
+
+==============================================================
+Output for time 1.40000000e+01 
+==============================================================
+Output for domain   1
+
+
+DofManager output:
+------------------
+Node           1 (       1):
+  dof 14   d  9.80000000e-01
+Node           2 (       2):
+  dof 14   d  9.80000000e-01
+Node           3 (       3):
+  dof 14   d  9.80000000e-01
+Node           4 (       4):
+  dof 14   d  9.80000000e-01
+Node           5 (       5):
+  dof 14   d  5.00000000e-01
+Node           6 (       6):
+  dof 14   d  5.00000000e-01
+Node           7 (       7):
+  dof 14   d  5.00000000e-01
+Node           8 (       8):
+  dof 14   d  5.00000000e-01
+Node           9 (       9):
+  dof 14   d  9.80000000e-01
+Node          10 (      10):
+  dof 14   d  9.80000000e-01
+Node          11 (      11):
+  dof 14   d  9.80000000e-01
+Node          12 (      12):
+  dof 14   d  9.80000000e-01
+Node          13 (      13):
+  dof 14   d  9.80000000e-01
+Node          14 (      14):
+  dof 14   d  9.80000000e-01
+Node          15 (      15):
+  dof 14   d  9.80000000e-01
+Node          16 (      16):
+  dof 14   d  9.80000000e-01
+Node          17 (      17):
+  dof 14   d  9.80000000e-01
+Node          18 (      18):
+  dof 14   d  9.80000000e-01
+Node          19 (      19):
+  dof 14   d  9.80000000e-01
+Node          20 (      20):
+  dof 14   d  9.80000000e-01
+Node          21 (      21):
+  dof 14   d  9.80000000e-01
+Node          22 (      22):
+  dof 14   d  9.80000000e-01
+Node          23 (      23):
+  dof 14   d  9.80000000e-01
+Node          24 (      24):
+  dof 14   d  9.80000000e-01
+
+
+
+
+Element output:
+---------------
+element 1 (       1) :
+  GP  1.1  :  state 9.8000e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+  GP  1.2  :  state 9.8000e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+  GP  1.3  :  state 9.8000e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+  GP  1.4  :  state 9.8000e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+element 2 (       2) :
+  GP  1.1  :  state 5.0000e-01   flow -0.0000e+00 2.2204e-21 -0.0000e+00
+  GP  1.2  :  state 5.0000e-01   flow -0.0000e+00 2.2204e-21 -0.0000e+00
+  GP  1.3  :  state 5.0000e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 5.0000e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+element 3 (       3) :
+  GP  1.1  :  state 9.8000e-01   flow -0.0000e+00 -4.4409e-21 -0.0000e+00
+  GP  1.2  :  state 9.8000e-01   flow -0.0000e+00 -4.4409e-21 -0.0000e+00
+  GP  1.3  :  state 9.8000e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+  GP  1.4  :  state 9.8000e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+element 4 (       4) :
+  GP  1.1  :  state 9.8000e-01   flow -0.0000e+00 8.8818e-21 -0.0000e+00
+  GP  1.2  :  state 9.8000e-01   flow -0.0000e+00 8.8818e-21 -0.0000e+00
+  GP  1.3  :  state 9.8000e-01   flow -0.0000e+00 8.8818e-21 -0.0000e+00
+  GP  1.4  :  state 9.8000e-01   flow -0.0000e+00 8.8818e-21 -0.0000e+00
+element 5 (       5) :
+  GP  1.1  :  state 9.8000e-01   flow -0.0000e+00 -4.4409e-21 -0.0000e+00
+  GP  1.2  :  state 9.8000e-01   flow -0.0000e+00 -4.4409e-21 -0.0000e+00
+  GP  1.3  :  state 9.8000e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+  GP  1.4  :  state 9.8000e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+element 6 (       6) :
+  GP  1.1  :  state 9.8000e-01   flow -0.0000e+00 4.4409e-21 -0.0000e+00
+  GP  1.2  :  state 9.8000e-01   flow -0.0000e+00 4.4409e-21 -0.0000e+00
+  GP  1.3  :  state 9.8000e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+  GP  1.4  :  state 9.8000e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+
+
+
+==============================================================
+Output for time 1.40000000e+01 
+==============================================================
+Output for domain   1
+
+
+DofManager output:
+------------------
+Node           1 (       1):
+  dof 14   d  9.80000000e-01
+Node           2 (       2):
+  dof 14   d  9.80000000e-01
+Node           3 (       3):
+  dof 14   d  9.80000000e-01
+Node           4 (       4):
+  dof 14   d  9.80000000e-01
+Node           5 (       5):
+  dof 14   d  5.00000000e-01
+Node           6 (       6):
+  dof 14   d  5.00000000e-01
+Node           7 (       7):
+  dof 14   d  5.00000000e-01
+Node           8 (       8):
+  dof 14   d  5.00000000e-01
+Node           9 (       9):
+  dof 14   d  9.80000000e-01
+Node          10 (      10):
+  dof 14   d  9.80000000e-01
+Node          11 (      11):
+  dof 14   d  9.80000000e-01
+Node          12 (      12):
+  dof 14   d  9.80000000e-01
+Node          13 (      13):
+  dof 14   d  9.80000000e-01
+Node          14 (      14):
+  dof 14   d  9.80000000e-01
+Node          15 (      15):
+  dof 14   d  9.80000000e-01
+Node          16 (      16):
+  dof 14   d  9.80000000e-01
+Node          17 (      17):
+  dof 14   d  9.80000000e-01
+Node          18 (      18):
+  dof 14   d  9.80000000e-01
+Node          19 (      19):
+  dof 14   d  9.80000000e-01
+Node          20 (      20):
+  dof 14   d  9.80000000e-01
+Node          21 (      21):
+  dof 14   d  9.80000000e-01
+Node          22 (      22):
+  dof 14   d  9.80000000e-01
+Node          23 (      23):
+  dof 14   d  9.80000000e-01
+Node          24 (      24):
+  dof 14   d  9.80000000e-01
+
+
+
+
+Element output:
+---------------
+element 1 (       1) :
+  GP  1.1  :  state 9.8000e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+  GP  1.2  :  state 9.8000e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+  GP  1.3  :  state 9.8000e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+  GP  1.4  :  state 9.8000e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+element 2 (       2) :
+  GP  1.1  :  state 5.0000e-01   flow -0.0000e+00 2.2204e-21 -0.0000e+00
+  GP  1.2  :  state 5.0000e-01   flow -0.0000e+00 2.2204e-21 -0.0000e+00
+  GP  1.3  :  state 5.0000e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 5.0000e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+element 3 (       3) :
+  GP  1.1  :  state 9.8000e-01   flow -0.0000e+00 -4.4409e-21 -0.0000e+00
+  GP  1.2  :  state 9.8000e-01   flow -0.0000e+00 -4.4409e-21 -0.0000e+00
+  GP  1.3  :  state 9.8000e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+  GP  1.4  :  state 9.8000e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+element 4 (       4) :
+  GP  1.1  :  state 9.8000e-01   flow -0.0000e+00 8.8818e-21 -0.0000e+00
+  GP  1.2  :  state 9.8000e-01   flow -0.0000e+00 8.8818e-21 -0.0000e+00
+  GP  1.3  :  state 9.8000e-01   flow -0.0000e+00 8.8818e-21 -0.0000e+00
+  GP  1.4  :  state 9.8000e-01   flow -0.0000e+00 8.8818e-21 -0.0000e+00
+element 5 (       5) :
+  GP  1.1  :  state 9.8000e-01   flow -0.0000e+00 -4.4409e-21 -0.0000e+00
+  GP  1.2  :  state 9.8000e-01   flow -0.0000e+00 -4.4409e-21 -0.0000e+00
+  GP  1.3  :  state 9.8000e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+  GP  1.4  :  state 9.8000e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+element 6 (       6) :
+  GP  1.1  :  state 9.8000e-01   flow -0.0000e+00 4.4409e-21 -0.0000e+00
+  GP  1.2  :  state 9.8000e-01   flow -0.0000e+00 4.4409e-21 -0.0000e+00
+  GP  1.3  :  state 9.8000e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+  GP  1.4  :  state 9.8000e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+
+
+
+==============================================================
+Output for time 1.40001000e+01 
+==============================================================
+Output for domain   1
+
+
+DofManager output:
+------------------
+Node           1 (       1):
+  dof 14   d  9.80000000e-01
+Node           2 (       2):
+  dof 14   d  9.80000000e-01
+Node           3 (       3):
+  dof 14   d  9.80000000e-01
+Node           4 (       4):
+  dof 14   d  9.80000000e-01
+Node           5 (       5):
+  dof 14   d  5.00000000e-01
+Node           6 (       6):
+  dof 14   d  5.00000000e-01
+Node           7 (       7):
+  dof 14   d  5.00000000e-01
+Node           8 (       8):
+  dof 14   d  5.00000000e-01
+Node           9 (       9):
+  dof 14   d  9.80000000e-01
+Node          10 (      10):
+  dof 14   d  9.80000000e-01
+Node          11 (      11):
+  dof 14   d  9.80000000e-01
+Node          12 (      12):
+  dof 14   d  9.80000000e-01
+Node          13 (      13):
+  dof 14   d  9.80000000e-01
+Node          14 (      14):
+  dof 14   d  9.80000000e-01
+Node          15 (      15):
+  dof 14   d  9.80000000e-01
+Node          16 (      16):
+  dof 14   d  9.80000000e-01
+Node          17 (      17):
+  dof 14   d  9.80000000e-01
+Node          18 (      18):
+  dof 14   d  9.80000000e-01
+Node          19 (      19):
+  dof 14   d  9.80000000e-01
+Node          20 (      20):
+  dof 14   d  9.80000000e-01
+Node          21 (      21):
+  dof 14   d  9.80000000e-01
+Node          22 (      22):
+  dof 14   d  9.80000000e-01
+Node          23 (      23):
+  dof 14   d  9.80000000e-01
+Node          24 (      24):
+  dof 14   d  9.80000000e-01
+
+
+
+
+Element output:
+---------------
+element 1 (       1) :
+  GP  1.1  :  state 9.8000e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+  GP  1.2  :  state 9.8000e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+  GP  1.3  :  state 9.8000e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+  GP  1.4  :  state 9.8000e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+element 2 (       2) :
+  GP  1.1  :  state 5.0000e-01   flow -0.0000e+00 2.2204e-21 -0.0000e+00
+  GP  1.2  :  state 5.0000e-01   flow -0.0000e+00 2.2204e-21 -0.0000e+00
+  GP  1.3  :  state 5.0000e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 5.0000e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+element 3 (       3) :
+  GP  1.1  :  state 9.8000e-01   flow -0.0000e+00 -4.4409e-21 -0.0000e+00
+  GP  1.2  :  state 9.8000e-01   flow -0.0000e+00 -4.4409e-21 -0.0000e+00
+  GP  1.3  :  state 9.8000e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+  GP  1.4  :  state 9.8000e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+element 4 (       4) :
+  GP  1.1  :  state 9.8000e-01   flow -0.0000e+00 8.8818e-21 -0.0000e+00
+  GP  1.2  :  state 9.8000e-01   flow -0.0000e+00 8.8818e-21 -0.0000e+00
+  GP  1.3  :  state 9.8000e-01   flow -0.0000e+00 8.8818e-21 -0.0000e+00
+  GP  1.4  :  state 9.8000e-01   flow -0.0000e+00 8.8818e-21 -0.0000e+00
+element 5 (       5) :
+  GP  1.1  :  state 9.8000e-01   flow -0.0000e+00 -4.4409e-21 -0.0000e+00
+  GP  1.2  :  state 9.8000e-01   flow -0.0000e+00 -4.4409e-21 -0.0000e+00
+  GP  1.3  :  state 9.8000e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+  GP  1.4  :  state 9.8000e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+element 6 (       6) :
+  GP  1.1  :  state 9.8000e-01   flow -0.0000e+00 4.4409e-21 -0.0000e+00
+  GP  1.2  :  state 9.8000e-01   flow -0.0000e+00 4.4409e-21 -0.0000e+00
+  GP  1.3  :  state 9.8000e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+  GP  1.4  :  state 9.8000e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+
+
+
+==============================================================
+Output for time 1.40002000e+01 
+==============================================================
+Output for domain   1
+
+
+DofManager output:
+------------------
+Node           1 (       1):
+  dof 14   d  9.80000000e-01
+Node           2 (       2):
+  dof 14   d  9.80000000e-01
+Node           3 (       3):
+  dof 14   d  9.80000000e-01
+Node           4 (       4):
+  dof 14   d  9.80000000e-01
+Node           5 (       5):
+  dof 14   d  5.00000000e-01
+Node           6 (       6):
+  dof 14   d  5.00000000e-01
+Node           7 (       7):
+  dof 14   d  5.00000000e-01
+Node           8 (       8):
+  dof 14   d  5.00000000e-01
+Node           9 (       9):
+  dof 14   d  9.80000000e-01
+Node          10 (      10):
+  dof 14   d  9.80000000e-01
+Node          11 (      11):
+  dof 14   d  9.80000000e-01
+Node          12 (      12):
+  dof 14   d  9.80000000e-01
+Node          13 (      13):
+  dof 14   d  9.80000000e-01
+Node          14 (      14):
+  dof 14   d  9.80000000e-01
+Node          15 (      15):
+  dof 14   d  9.80000000e-01
+Node          16 (      16):
+  dof 14   d  9.80000000e-01
+Node          17 (      17):
+  dof 14   d  9.80000000e-01
+Node          18 (      18):
+  dof 14   d  9.80000000e-01
+Node          19 (      19):
+  dof 14   d  9.80000000e-01
+Node          20 (      20):
+  dof 14   d  9.80000000e-01
+Node          21 (      21):
+  dof 14   d  9.80000000e-01
+Node          22 (      22):
+  dof 14   d  9.80000000e-01
+Node          23 (      23):
+  dof 14   d  9.80000000e-01
+Node          24 (      24):
+  dof 14   d  9.80000000e-01
+
+
+
+
+Element output:
+---------------
+element 1 (       1) :
+  GP  1.1  :  state 9.8000e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+  GP  1.2  :  state 9.8000e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+  GP  1.3  :  state 9.8000e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+  GP  1.4  :  state 9.8000e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+element 2 (       2) :
+  GP  1.1  :  state 5.0000e-01   flow -0.0000e+00 2.2204e-21 -0.0000e+00
+  GP  1.2  :  state 5.0000e-01   flow -0.0000e+00 2.2204e-21 -0.0000e+00
+  GP  1.3  :  state 5.0000e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 5.0000e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+element 3 (       3) :
+  GP  1.1  :  state 9.8000e-01   flow -0.0000e+00 -4.4409e-21 -0.0000e+00
+  GP  1.2  :  state 9.8000e-01   flow -0.0000e+00 -4.4409e-21 -0.0000e+00
+  GP  1.3  :  state 9.8000e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+  GP  1.4  :  state 9.8000e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+element 4 (       4) :
+  GP  1.1  :  state 9.8000e-01   flow -0.0000e+00 8.8818e-21 -0.0000e+00
+  GP  1.2  :  state 9.8000e-01   flow -0.0000e+00 8.8818e-21 -0.0000e+00
+  GP  1.3  :  state 9.8000e-01   flow -0.0000e+00 8.8818e-21 -0.0000e+00
+  GP  1.4  :  state 9.8000e-01   flow -0.0000e+00 8.8818e-21 -0.0000e+00
+element 5 (       5) :
+  GP  1.1  :  state 9.8000e-01   flow -0.0000e+00 -4.4409e-21 -0.0000e+00
+  GP  1.2  :  state 9.8000e-01   flow -0.0000e+00 -4.4409e-21 -0.0000e+00
+  GP  1.3  :  state 9.8000e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+  GP  1.4  :  state 9.8000e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+element 6 (       6) :
+  GP  1.1  :  state 9.8000e-01   flow -0.0000e+00 4.4409e-21 -0.0000e+00
+  GP  1.2  :  state 9.8000e-01   flow -0.0000e+00 4.4409e-21 -0.0000e+00
+  GP  1.3  :  state 9.8000e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+  GP  1.4  :  state 9.8000e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+
+
+
+==============================================================
+Output for time 1.40005000e+01 
+==============================================================
+Output for domain   1
+
+
+DofManager output:
+------------------
+Node           1 (       1):
+  dof 14   d  9.80000000e-01
+Node           2 (       2):
+  dof 14   d  9.80000000e-01
+Node           3 (       3):
+  dof 14   d  9.80000000e-01
+Node           4 (       4):
+  dof 14   d  9.80000000e-01
+Node           5 (       5):
+  dof 14   d  5.00000000e-01
+Node           6 (       6):
+  dof 14   d  5.00000000e-01
+Node           7 (       7):
+  dof 14   d  5.00000000e-01
+Node           8 (       8):
+  dof 14   d  5.00000000e-01
+Node           9 (       9):
+  dof 14   d  9.80000000e-01
+Node          10 (      10):
+  dof 14   d  9.80000000e-01
+Node          11 (      11):
+  dof 14   d  9.80000000e-01
+Node          12 (      12):
+  dof 14   d  9.80000000e-01
+Node          13 (      13):
+  dof 14   d  9.80000000e-01
+Node          14 (      14):
+  dof 14   d  9.80000000e-01
+Node          15 (      15):
+  dof 14   d  9.80000000e-01
+Node          16 (      16):
+  dof 14   d  9.80000000e-01
+Node          17 (      17):
+  dof 14   d  9.80000000e-01
+Node          18 (      18):
+  dof 14   d  9.80000000e-01
+Node          19 (      19):
+  dof 14   d  9.80000000e-01
+Node          20 (      20):
+  dof 14   d  9.80000000e-01
+Node          21 (      21):
+  dof 14   d  9.80000000e-01
+Node          22 (      22):
+  dof 14   d  9.80000000e-01
+Node          23 (      23):
+  dof 14   d  9.80000000e-01
+Node          24 (      24):
+  dof 14   d  9.80000000e-01
+
+
+
+
+Element output:
+---------------
+element 1 (       1) :
+  GP  1.1  :  state 9.8000e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+  GP  1.2  :  state 9.8000e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+  GP  1.3  :  state 9.8000e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+  GP  1.4  :  state 9.8000e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+element 2 (       2) :
+  GP  1.1  :  state 5.0000e-01   flow -0.0000e+00 2.2204e-21 -0.0000e+00
+  GP  1.2  :  state 5.0000e-01   flow -0.0000e+00 2.2204e-21 -0.0000e+00
+  GP  1.3  :  state 5.0000e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 5.0000e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+element 3 (       3) :
+  GP  1.1  :  state 9.8000e-01   flow -0.0000e+00 -4.4409e-21 -0.0000e+00
+  GP  1.2  :  state 9.8000e-01   flow -0.0000e+00 -4.4409e-21 -0.0000e+00
+  GP  1.3  :  state 9.8000e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+  GP  1.4  :  state 9.8000e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+element 4 (       4) :
+  GP  1.1  :  state 9.8000e-01   flow -0.0000e+00 8.8818e-21 -0.0000e+00
+  GP  1.2  :  state 9.8000e-01   flow -0.0000e+00 8.8818e-21 -0.0000e+00
+  GP  1.3  :  state 9.8000e-01   flow -0.0000e+00 8.8818e-21 -0.0000e+00
+  GP  1.4  :  state 9.8000e-01   flow -0.0000e+00 8.8818e-21 -0.0000e+00
+element 5 (       5) :
+  GP  1.1  :  state 9.8000e-01   flow -0.0000e+00 -4.4409e-21 -0.0000e+00
+  GP  1.2  :  state 9.8000e-01   flow -0.0000e+00 -4.4409e-21 -0.0000e+00
+  GP  1.3  :  state 9.8000e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+  GP  1.4  :  state 9.8000e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+element 6 (       6) :
+  GP  1.1  :  state 9.8000e-01   flow -0.0000e+00 4.4409e-21 -0.0000e+00
+  GP  1.2  :  state 9.8000e-01   flow -0.0000e+00 4.4409e-21 -0.0000e+00
+  GP  1.3  :  state 9.8000e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+  GP  1.4  :  state 9.8000e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+
+
+
+==============================================================
+Output for time 1.40010000e+01 
+==============================================================
+Output for domain   1
+
+
+DofManager output:
+------------------
+Node           1 (       1):
+  dof 14   d  9.80000000e-01
+Node           2 (       2):
+  dof 14   d  9.80000000e-01
+Node           3 (       3):
+  dof 14   d  9.80000000e-01
+Node           4 (       4):
+  dof 14   d  9.80000000e-01
+Node           5 (       5):
+  dof 14   d  5.00000000e-01
+Node           6 (       6):
+  dof 14   d  5.00000000e-01
+Node           7 (       7):
+  dof 14   d  5.00000000e-01
+Node           8 (       8):
+  dof 14   d  5.00000000e-01
+Node           9 (       9):
+  dof 14   d  9.80000000e-01
+Node          10 (      10):
+  dof 14   d  9.80000000e-01
+Node          11 (      11):
+  dof 14   d  9.80000000e-01
+Node          12 (      12):
+  dof 14   d  9.80000000e-01
+Node          13 (      13):
+  dof 14   d  9.80000000e-01
+Node          14 (      14):
+  dof 14   d  9.80000000e-01
+Node          15 (      15):
+  dof 14   d  9.80000000e-01
+Node          16 (      16):
+  dof 14   d  9.80000000e-01
+Node          17 (      17):
+  dof 14   d  9.80000000e-01
+Node          18 (      18):
+  dof 14   d  9.80000000e-01
+Node          19 (      19):
+  dof 14   d  9.80000000e-01
+Node          20 (      20):
+  dof 14   d  9.80000000e-01
+Node          21 (      21):
+  dof 14   d  9.80000000e-01
+Node          22 (      22):
+  dof 14   d  9.80000000e-01
+Node          23 (      23):
+  dof 14   d  9.80000000e-01
+Node          24 (      24):
+  dof 14   d  9.80000000e-01
+
+
+
+
+Element output:
+---------------
+element 1 (       1) :
+  GP  1.1  :  state 9.8000e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+  GP  1.2  :  state 9.8000e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+  GP  1.3  :  state 9.8000e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+  GP  1.4  :  state 9.8000e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+element 2 (       2) :
+  GP  1.1  :  state 5.0000e-01   flow -0.0000e+00 2.2204e-21 -0.0000e+00
+  GP  1.2  :  state 5.0000e-01   flow -0.0000e+00 2.2204e-21 -0.0000e+00
+  GP  1.3  :  state 5.0000e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 5.0000e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+element 3 (       3) :
+  GP  1.1  :  state 9.8000e-01   flow -0.0000e+00 -4.4409e-21 -0.0000e+00
+  GP  1.2  :  state 9.8000e-01   flow -0.0000e+00 -4.4409e-21 -0.0000e+00
+  GP  1.3  :  state 9.8000e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+  GP  1.4  :  state 9.8000e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+element 4 (       4) :
+  GP  1.1  :  state 9.8000e-01   flow -0.0000e+00 8.8818e-21 -0.0000e+00
+  GP  1.2  :  state 9.8000e-01   flow -0.0000e+00 8.8818e-21 -0.0000e+00
+  GP  1.3  :  state 9.8000e-01   flow -0.0000e+00 8.8818e-21 -0.0000e+00
+  GP  1.4  :  state 9.8000e-01   flow -0.0000e+00 8.8818e-21 -0.0000e+00
+element 5 (       5) :
+  GP  1.1  :  state 9.8000e-01   flow -0.0000e+00 -4.4409e-21 -0.0000e+00
+  GP  1.2  :  state 9.8000e-01   flow -0.0000e+00 -4.4409e-21 -0.0000e+00
+  GP  1.3  :  state 9.8000e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+  GP  1.4  :  state 9.8000e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+element 6 (       6) :
+  GP  1.1  :  state 9.8000e-01   flow -0.0000e+00 4.4409e-21 -0.0000e+00
+  GP  1.2  :  state 9.8000e-01   flow -0.0000e+00 4.4409e-21 -0.0000e+00
+  GP  1.3  :  state 9.8000e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+  GP  1.4  :  state 9.8000e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+
+
+
+==============================================================
+Output for time 1.40020000e+01 
+==============================================================
+Output for domain   1
+
+
+DofManager output:
+------------------
+Node           1 (       1):
+  dof 14   d  9.80000000e-01
+Node           2 (       2):
+  dof 14   d  9.80000000e-01
+Node           3 (       3):
+  dof 14   d  9.80000000e-01
+Node           4 (       4):
+  dof 14   d  9.80000000e-01
+Node           5 (       5):
+  dof 14   d  5.00000000e-01
+Node           6 (       6):
+  dof 14   d  5.00000000e-01
+Node           7 (       7):
+  dof 14   d  5.00000000e-01
+Node           8 (       8):
+  dof 14   d  5.00000000e-01
+Node           9 (       9):
+  dof 14   d  9.80000000e-01
+Node          10 (      10):
+  dof 14   d  9.80000000e-01
+Node          11 (      11):
+  dof 14   d  9.80000000e-01
+Node          12 (      12):
+  dof 14   d  9.80000000e-01
+Node          13 (      13):
+  dof 14   d  9.80000000e-01
+Node          14 (      14):
+  dof 14   d  9.80000000e-01
+Node          15 (      15):
+  dof 14   d  9.80000000e-01
+Node          16 (      16):
+  dof 14   d  9.80000000e-01
+Node          17 (      17):
+  dof 14   d  9.80000000e-01
+Node          18 (      18):
+  dof 14   d  9.80000000e-01
+Node          19 (      19):
+  dof 14   d  9.80000000e-01
+Node          20 (      20):
+  dof 14   d  9.80000000e-01
+Node          21 (      21):
+  dof 14   d  9.80000000e-01
+Node          22 (      22):
+  dof 14   d  9.80000000e-01
+Node          23 (      23):
+  dof 14   d  9.80000000e-01
+Node          24 (      24):
+  dof 14   d  9.80000000e-01
+
+
+
+
+Element output:
+---------------
+element 1 (       1) :
+  GP  1.1  :  state 9.8000e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+  GP  1.2  :  state 9.8000e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+  GP  1.3  :  state 9.8000e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+  GP  1.4  :  state 9.8000e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+element 2 (       2) :
+  GP  1.1  :  state 5.0000e-01   flow -0.0000e+00 2.2204e-21 -0.0000e+00
+  GP  1.2  :  state 5.0000e-01   flow -0.0000e+00 2.2204e-21 -0.0000e+00
+  GP  1.3  :  state 5.0000e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 5.0000e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+element 3 (       3) :
+  GP  1.1  :  state 9.8000e-01   flow -0.0000e+00 -4.4409e-21 -0.0000e+00
+  GP  1.2  :  state 9.8000e-01   flow -0.0000e+00 -4.4409e-21 -0.0000e+00
+  GP  1.3  :  state 9.8000e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+  GP  1.4  :  state 9.8000e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+element 4 (       4) :
+  GP  1.1  :  state 9.8000e-01   flow -0.0000e+00 8.8818e-21 -0.0000e+00
+  GP  1.2  :  state 9.8000e-01   flow -0.0000e+00 8.8818e-21 -0.0000e+00
+  GP  1.3  :  state 9.8000e-01   flow -0.0000e+00 8.8818e-21 -0.0000e+00
+  GP  1.4  :  state 9.8000e-01   flow -0.0000e+00 8.8818e-21 -0.0000e+00
+element 5 (       5) :
+  GP  1.1  :  state 9.8000e-01   flow -0.0000e+00 -4.4409e-21 -0.0000e+00
+  GP  1.2  :  state 9.8000e-01   flow -0.0000e+00 -4.4409e-21 -0.0000e+00
+  GP  1.3  :  state 9.8000e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+  GP  1.4  :  state 9.8000e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+element 6 (       6) :
+  GP  1.1  :  state 9.8000e-01   flow -0.0000e+00 4.4409e-21 -0.0000e+00
+  GP  1.2  :  state 9.8000e-01   flow -0.0000e+00 4.4409e-21 -0.0000e+00
+  GP  1.3  :  state 9.8000e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+  GP  1.4  :  state 9.8000e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+
+
+
+==============================================================
+Output for time 1.40050000e+01 
+==============================================================
+Output for domain   1
+
+
+DofManager output:
+------------------
+Node           1 (       1):
+  dof 14   d  9.80000000e-01
+Node           2 (       2):
+  dof 14   d  9.80000000e-01
+Node           3 (       3):
+  dof 14   d  9.80000000e-01
+Node           4 (       4):
+  dof 14   d  9.80000000e-01
+Node           5 (       5):
+  dof 14   d  5.00000000e-01
+Node           6 (       6):
+  dof 14   d  5.00000000e-01
+Node           7 (       7):
+  dof 14   d  5.00000000e-01
+Node           8 (       8):
+  dof 14   d  5.00000000e-01
+Node           9 (       9):
+  dof 14   d  9.80000000e-01
+Node          10 (      10):
+  dof 14   d  9.80000000e-01
+Node          11 (      11):
+  dof 14   d  9.80000000e-01
+Node          12 (      12):
+  dof 14   d  9.80000000e-01
+Node          13 (      13):
+  dof 14   d  9.80000000e-01
+Node          14 (      14):
+  dof 14   d  9.80000000e-01
+Node          15 (      15):
+  dof 14   d  9.80000000e-01
+Node          16 (      16):
+  dof 14   d  9.80000000e-01
+Node          17 (      17):
+  dof 14   d  9.80000000e-01
+Node          18 (      18):
+  dof 14   d  9.80000000e-01
+Node          19 (      19):
+  dof 14   d  9.80000000e-01
+Node          20 (      20):
+  dof 14   d  9.80000000e-01
+Node          21 (      21):
+  dof 14   d  9.80000000e-01
+Node          22 (      22):
+  dof 14   d  9.80000000e-01
+Node          23 (      23):
+  dof 14   d  9.80000000e-01
+Node          24 (      24):
+  dof 14   d  9.80000000e-01
+
+
+
+
+Element output:
+---------------
+element 1 (       1) :
+  GP  1.1  :  state 9.8000e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+  GP  1.2  :  state 9.8000e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+  GP  1.3  :  state 9.8000e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+  GP  1.4  :  state 9.8000e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+element 2 (       2) :
+  GP  1.1  :  state 5.0000e-01   flow -0.0000e+00 2.2204e-21 -0.0000e+00
+  GP  1.2  :  state 5.0000e-01   flow -0.0000e+00 2.2204e-21 -0.0000e+00
+  GP  1.3  :  state 5.0000e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 5.0000e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+element 3 (       3) :
+  GP  1.1  :  state 9.8000e-01   flow -0.0000e+00 -4.4409e-21 -0.0000e+00
+  GP  1.2  :  state 9.8000e-01   flow -0.0000e+00 -4.4409e-21 -0.0000e+00
+  GP  1.3  :  state 9.8000e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+  GP  1.4  :  state 9.8000e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+element 4 (       4) :
+  GP  1.1  :  state 9.8000e-01   flow -0.0000e+00 8.8818e-21 -0.0000e+00
+  GP  1.2  :  state 9.8000e-01   flow -0.0000e+00 8.8818e-21 -0.0000e+00
+  GP  1.3  :  state 9.8000e-01   flow -0.0000e+00 8.8818e-21 -0.0000e+00
+  GP  1.4  :  state 9.8000e-01   flow -0.0000e+00 8.8818e-21 -0.0000e+00
+element 5 (       5) :
+  GP  1.1  :  state 9.8000e-01   flow -0.0000e+00 -4.4409e-21 -0.0000e+00
+  GP  1.2  :  state 9.8000e-01   flow -0.0000e+00 -4.4409e-21 -0.0000e+00
+  GP  1.3  :  state 9.8000e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+  GP  1.4  :  state 9.8000e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+element 6 (       6) :
+  GP  1.1  :  state 9.8000e-01   flow -0.0000e+00 4.4409e-21 -0.0000e+00
+  GP  1.2  :  state 9.8000e-01   flow -0.0000e+00 4.4409e-21 -0.0000e+00
+  GP  1.3  :  state 9.8000e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+  GP  1.4  :  state 9.8000e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+
+
+
+==============================================================
+Output for time 1.40100000e+01 
+==============================================================
+Output for domain   1
+
+
+DofManager output:
+------------------
+Node           1 (       1):
+  dof 14   d  9.80000000e-01
+Node           2 (       2):
+  dof 14   d  9.80000000e-01
+Node           3 (       3):
+  dof 14   d  9.80000000e-01
+Node           4 (       4):
+  dof 14   d  9.80000000e-01
+Node           5 (       5):
+  dof 14   d  5.00000000e-01
+Node           6 (       6):
+  dof 14   d  5.00000000e-01
+Node           7 (       7):
+  dof 14   d  5.00000000e-01
+Node           8 (       8):
+  dof 14   d  5.00000000e-01
+Node           9 (       9):
+  dof 14   d  9.80000000e-01
+Node          10 (      10):
+  dof 14   d  9.80000000e-01
+Node          11 (      11):
+  dof 14   d  9.80000000e-01
+Node          12 (      12):
+  dof 14   d  9.80000000e-01
+Node          13 (      13):
+  dof 14   d  9.80000000e-01
+Node          14 (      14):
+  dof 14   d  9.80000000e-01
+Node          15 (      15):
+  dof 14   d  9.80000000e-01
+Node          16 (      16):
+  dof 14   d  9.80000000e-01
+Node          17 (      17):
+  dof 14   d  9.80000000e-01
+Node          18 (      18):
+  dof 14   d  9.80000000e-01
+Node          19 (      19):
+  dof 14   d  9.80000000e-01
+Node          20 (      20):
+  dof 14   d  9.80000000e-01
+Node          21 (      21):
+  dof 14   d  9.80000000e-01
+Node          22 (      22):
+  dof 14   d  9.80000000e-01
+Node          23 (      23):
+  dof 14   d  9.80000000e-01
+Node          24 (      24):
+  dof 14   d  9.80000000e-01
+
+
+
+
+Element output:
+---------------
+element 1 (       1) :
+  GP  1.1  :  state 9.8000e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+  GP  1.2  :  state 9.8000e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+  GP  1.3  :  state 9.8000e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+  GP  1.4  :  state 9.8000e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+element 2 (       2) :
+  GP  1.1  :  state 5.0000e-01   flow -0.0000e+00 2.2204e-21 -0.0000e+00
+  GP  1.2  :  state 5.0000e-01   flow -0.0000e+00 2.2204e-21 -0.0000e+00
+  GP  1.3  :  state 5.0000e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 5.0000e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+element 3 (       3) :
+  GP  1.1  :  state 9.8000e-01   flow -0.0000e+00 -4.4409e-21 -0.0000e+00
+  GP  1.2  :  state 9.8000e-01   flow -0.0000e+00 -4.4409e-21 -0.0000e+00
+  GP  1.3  :  state 9.8000e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+  GP  1.4  :  state 9.8000e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+element 4 (       4) :
+  GP  1.1  :  state 9.8000e-01   flow -0.0000e+00 8.8818e-21 -0.0000e+00
+  GP  1.2  :  state 9.8000e-01   flow -0.0000e+00 8.8818e-21 -0.0000e+00
+  GP  1.3  :  state 9.8000e-01   flow -0.0000e+00 8.8818e-21 -0.0000e+00
+  GP  1.4  :  state 9.8000e-01   flow -0.0000e+00 8.8818e-21 -0.0000e+00
+element 5 (       5) :
+  GP  1.1  :  state 9.8000e-01   flow -0.0000e+00 -4.4409e-21 -0.0000e+00
+  GP  1.2  :  state 9.8000e-01   flow -0.0000e+00 -4.4409e-21 -0.0000e+00
+  GP  1.3  :  state 9.8000e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+  GP  1.4  :  state 9.8000e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+element 6 (       6) :
+  GP  1.1  :  state 9.8000e-01   flow -0.0000e+00 4.4409e-21 -0.0000e+00
+  GP  1.2  :  state 9.8000e-01   flow -0.0000e+00 4.4409e-21 -0.0000e+00
+  GP  1.3  :  state 9.8000e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+  GP  1.4  :  state 9.8000e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+
+
+
+==============================================================
+Output for time 1.40200000e+01 
+==============================================================
+Output for domain   1
+
+
+DofManager output:
+------------------
+Node           1 (       1):
+  dof 14   d  9.80000000e-01
+Node           2 (       2):
+  dof 14   d  9.80000000e-01
+Node           3 (       3):
+  dof 14   d  9.80000000e-01
+Node           4 (       4):
+  dof 14   d  9.80000000e-01
+Node           5 (       5):
+  dof 14   d  5.00000000e-01
+Node           6 (       6):
+  dof 14   d  5.00000000e-01
+Node           7 (       7):
+  dof 14   d  5.00000000e-01
+Node           8 (       8):
+  dof 14   d  5.00000000e-01
+Node           9 (       9):
+  dof 14   d  9.80000000e-01
+Node          10 (      10):
+  dof 14   d  9.80000000e-01
+Node          11 (      11):
+  dof 14   d  9.80000000e-01
+Node          12 (      12):
+  dof 14   d  9.80000000e-01
+Node          13 (      13):
+  dof 14   d  9.80000000e-01
+Node          14 (      14):
+  dof 14   d  9.80000000e-01
+Node          15 (      15):
+  dof 14   d  9.80000000e-01
+Node          16 (      16):
+  dof 14   d  9.80000000e-01
+Node          17 (      17):
+  dof 14   d  9.80000000e-01
+Node          18 (      18):
+  dof 14   d  9.80000000e-01
+Node          19 (      19):
+  dof 14   d  9.80000000e-01
+Node          20 (      20):
+  dof 14   d  9.80000000e-01
+Node          21 (      21):
+  dof 14   d  9.80000000e-01
+Node          22 (      22):
+  dof 14   d  9.80000000e-01
+Node          23 (      23):
+  dof 14   d  9.80000000e-01
+Node          24 (      24):
+  dof 14   d  9.80000000e-01
+
+
+
+
+Element output:
+---------------
+element 1 (       1) :
+  GP  1.1  :  state 9.8000e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+  GP  1.2  :  state 9.8000e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+  GP  1.3  :  state 9.8000e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+  GP  1.4  :  state 9.8000e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+element 2 (       2) :
+  GP  1.1  :  state 5.0000e-01   flow -0.0000e+00 2.2204e-21 -0.0000e+00
+  GP  1.2  :  state 5.0000e-01   flow -0.0000e+00 2.2204e-21 -0.0000e+00
+  GP  1.3  :  state 5.0000e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 5.0000e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+element 3 (       3) :
+  GP  1.1  :  state 9.8000e-01   flow -0.0000e+00 -4.4409e-21 -0.0000e+00
+  GP  1.2  :  state 9.8000e-01   flow -0.0000e+00 -4.4409e-21 -0.0000e+00
+  GP  1.3  :  state 9.8000e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+  GP  1.4  :  state 9.8000e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+element 4 (       4) :
+  GP  1.1  :  state 9.8000e-01   flow -0.0000e+00 8.8818e-21 -0.0000e+00
+  GP  1.2  :  state 9.8000e-01   flow -0.0000e+00 8.8818e-21 -0.0000e+00
+  GP  1.3  :  state 9.8000e-01   flow -0.0000e+00 8.8818e-21 -0.0000e+00
+  GP  1.4  :  state 9.8000e-01   flow -0.0000e+00 8.8818e-21 -0.0000e+00
+element 5 (       5) :
+  GP  1.1  :  state 9.8000e-01   flow -0.0000e+00 -4.4409e-21 -0.0000e+00
+  GP  1.2  :  state 9.8000e-01   flow -0.0000e+00 -4.4409e-21 -0.0000e+00
+  GP  1.3  :  state 9.8000e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+  GP  1.4  :  state 9.8000e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+element 6 (       6) :
+  GP  1.1  :  state 9.8000e-01   flow -0.0000e+00 4.4409e-21 -0.0000e+00
+  GP  1.2  :  state 9.8000e-01   flow -0.0000e+00 4.4409e-21 -0.0000e+00
+  GP  1.3  :  state 9.8000e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+  GP  1.4  :  state 9.8000e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+
+
+
+==============================================================
+Output for time 1.40500000e+01 
+==============================================================
+Output for domain   1
+
+
+DofManager output:
+------------------
+Node           1 (       1):
+  dof 14   d  9.80000000e-01
+Node           2 (       2):
+  dof 14   d  9.80000000e-01
+Node           3 (       3):
+  dof 14   d  9.80000000e-01
+Node           4 (       4):
+  dof 14   d  9.80000000e-01
+Node           5 (       5):
+  dof 14   d  5.00000000e-01
+Node           6 (       6):
+  dof 14   d  5.00000000e-01
+Node           7 (       7):
+  dof 14   d  5.00000000e-01
+Node           8 (       8):
+  dof 14   d  5.00000000e-01
+Node           9 (       9):
+  dof 14   d  9.80000000e-01
+Node          10 (      10):
+  dof 14   d  9.80000000e-01
+Node          11 (      11):
+  dof 14   d  9.80000000e-01
+Node          12 (      12):
+  dof 14   d  9.80000000e-01
+Node          13 (      13):
+  dof 14   d  9.80000000e-01
+Node          14 (      14):
+  dof 14   d  9.80000000e-01
+Node          15 (      15):
+  dof 14   d  9.80000000e-01
+Node          16 (      16):
+  dof 14   d  9.80000000e-01
+Node          17 (      17):
+  dof 14   d  9.80000000e-01
+Node          18 (      18):
+  dof 14   d  9.80000000e-01
+Node          19 (      19):
+  dof 14   d  9.80000000e-01
+Node          20 (      20):
+  dof 14   d  9.80000000e-01
+Node          21 (      21):
+  dof 14   d  9.80000000e-01
+Node          22 (      22):
+  dof 14   d  9.80000000e-01
+Node          23 (      23):
+  dof 14   d  9.80000000e-01
+Node          24 (      24):
+  dof 14   d  9.80000000e-01
+
+
+
+
+Element output:
+---------------
+element 1 (       1) :
+  GP  1.1  :  state 9.8000e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+  GP  1.2  :  state 9.8000e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+  GP  1.3  :  state 9.8000e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+  GP  1.4  :  state 9.8000e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+element 2 (       2) :
+  GP  1.1  :  state 5.0000e-01   flow -0.0000e+00 2.2204e-21 -0.0000e+00
+  GP  1.2  :  state 5.0000e-01   flow -0.0000e+00 2.2204e-21 -0.0000e+00
+  GP  1.3  :  state 5.0000e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 5.0000e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+element 3 (       3) :
+  GP  1.1  :  state 9.8000e-01   flow -0.0000e+00 -4.4409e-21 -0.0000e+00
+  GP  1.2  :  state 9.8000e-01   flow -0.0000e+00 -4.4409e-21 -0.0000e+00
+  GP  1.3  :  state 9.8000e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+  GP  1.4  :  state 9.8000e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+element 4 (       4) :
+  GP  1.1  :  state 9.8000e-01   flow -0.0000e+00 8.8818e-21 -0.0000e+00
+  GP  1.2  :  state 9.8000e-01   flow -0.0000e+00 8.8818e-21 -0.0000e+00
+  GP  1.3  :  state 9.8000e-01   flow -0.0000e+00 8.8818e-21 -0.0000e+00
+  GP  1.4  :  state 9.8000e-01   flow -0.0000e+00 8.8818e-21 -0.0000e+00
+element 5 (       5) :
+  GP  1.1  :  state 9.8000e-01   flow -0.0000e+00 -4.4409e-21 -0.0000e+00
+  GP  1.2  :  state 9.8000e-01   flow -0.0000e+00 -4.4409e-21 -0.0000e+00
+  GP  1.3  :  state 9.8000e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+  GP  1.4  :  state 9.8000e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+element 6 (       6) :
+  GP  1.1  :  state 9.8000e-01   flow -0.0000e+00 4.4409e-21 -0.0000e+00
+  GP  1.2  :  state 9.8000e-01   flow -0.0000e+00 4.4409e-21 -0.0000e+00
+  GP  1.3  :  state 9.8000e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+  GP  1.4  :  state 9.8000e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+
+
+
+==============================================================
+Output for time 1.41000000e+01 
+==============================================================
+Output for domain   1
+
+
+DofManager output:
+------------------
+Node           1 (       1):
+  dof 14   d  9.80000000e-01
+Node           2 (       2):
+  dof 14   d  9.80000000e-01
+Node           3 (       3):
+  dof 14   d  9.80000000e-01
+Node           4 (       4):
+  dof 14   d  9.80000000e-01
+Node           5 (       5):
+  dof 14   d  5.00000000e-01
+Node           6 (       6):
+  dof 14   d  5.00000000e-01
+Node           7 (       7):
+  dof 14   d  5.00000000e-01
+Node           8 (       8):
+  dof 14   d  5.00000000e-01
+Node           9 (       9):
+  dof 14   d  9.80000000e-01
+Node          10 (      10):
+  dof 14   d  9.80000000e-01
+Node          11 (      11):
+  dof 14   d  9.80000000e-01
+Node          12 (      12):
+  dof 14   d  9.80000000e-01
+Node          13 (      13):
+  dof 14   d  9.80000000e-01
+Node          14 (      14):
+  dof 14   d  9.80000000e-01
+Node          15 (      15):
+  dof 14   d  9.80000000e-01
+Node          16 (      16):
+  dof 14   d  9.80000000e-01
+Node          17 (      17):
+  dof 14   d  9.80000000e-01
+Node          18 (      18):
+  dof 14   d  9.80000000e-01
+Node          19 (      19):
+  dof 14   d  9.80000000e-01
+Node          20 (      20):
+  dof 14   d  9.80000000e-01
+Node          21 (      21):
+  dof 14   d  9.80000000e-01
+Node          22 (      22):
+  dof 14   d  9.80000000e-01
+Node          23 (      23):
+  dof 14   d  9.80000000e-01
+Node          24 (      24):
+  dof 14   d  9.80000000e-01
+
+
+
+
+Element output:
+---------------
+element 1 (       1) :
+  GP  1.1  :  state 9.8000e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+  GP  1.2  :  state 9.8000e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+  GP  1.3  :  state 9.8000e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+  GP  1.4  :  state 9.8000e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+element 2 (       2) :
+  GP  1.1  :  state 5.0000e-01   flow -0.0000e+00 2.2204e-21 -0.0000e+00
+  GP  1.2  :  state 5.0000e-01   flow -0.0000e+00 2.2204e-21 -0.0000e+00
+  GP  1.3  :  state 5.0000e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 5.0000e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+element 3 (       3) :
+  GP  1.1  :  state 9.8000e-01   flow -0.0000e+00 -4.4409e-21 -0.0000e+00
+  GP  1.2  :  state 9.8000e-01   flow -0.0000e+00 -4.4409e-21 -0.0000e+00
+  GP  1.3  :  state 9.8000e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+  GP  1.4  :  state 9.8000e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+element 4 (       4) :
+  GP  1.1  :  state 9.8000e-01   flow -0.0000e+00 8.8818e-21 -0.0000e+00
+  GP  1.2  :  state 9.8000e-01   flow -0.0000e+00 8.8818e-21 -0.0000e+00
+  GP  1.3  :  state 9.8000e-01   flow -0.0000e+00 8.8818e-21 -0.0000e+00
+  GP  1.4  :  state 9.8000e-01   flow -0.0000e+00 8.8818e-21 -0.0000e+00
+element 5 (       5) :
+  GP  1.1  :  state 9.8000e-01   flow -0.0000e+00 -4.4409e-21 -0.0000e+00
+  GP  1.2  :  state 9.8000e-01   flow -0.0000e+00 -4.4409e-21 -0.0000e+00
+  GP  1.3  :  state 9.8000e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+  GP  1.4  :  state 9.8000e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+element 6 (       6) :
+  GP  1.1  :  state 9.8000e-01   flow -0.0000e+00 4.4409e-21 -0.0000e+00
+  GP  1.2  :  state 9.8000e-01   flow -0.0000e+00 4.4409e-21 -0.0000e+00
+  GP  1.3  :  state 9.8000e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+  GP  1.4  :  state 9.8000e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+
+
+
+==============================================================
+Output for time 1.42000000e+01 
+==============================================================
+Output for domain   1
+
+
+DofManager output:
+------------------
+Node           1 (       1):
+  dof 14   d  9.80000000e-01
+Node           2 (       2):
+  dof 14   d  9.80000000e-01
+Node           3 (       3):
+  dof 14   d  9.80000000e-01
+Node           4 (       4):
+  dof 14   d  9.80000000e-01
+Node           5 (       5):
+  dof 14   d  5.00000000e-01
+Node           6 (       6):
+  dof 14   d  5.00000000e-01
+Node           7 (       7):
+  dof 14   d  5.00000000e-01
+Node           8 (       8):
+  dof 14   d  5.00000000e-01
+Node           9 (       9):
+  dof 14   d  9.71111111e-01
+Node          10 (      10):
+  dof 14   d  9.71111111e-01
+Node          11 (      11):
+  dof 14   d  9.71111111e-01
+Node          12 (      12):
+  dof 14   d  9.71111111e-01
+Node          13 (      13):
+  dof 14   d  9.71111111e-01
+Node          14 (      14):
+  dof 14   d  9.71111111e-01
+Node          15 (      15):
+  dof 14   d  9.71111111e-01
+Node          16 (      16):
+  dof 14   d  9.71111111e-01
+Node          17 (      17):
+  dof 14   d  9.71111111e-01
+Node          18 (      18):
+  dof 14   d  9.71111111e-01
+Node          19 (      19):
+  dof 14   d  9.71111111e-01
+Node          20 (      20):
+  dof 14   d  9.71111111e-01
+Node          21 (      21):
+  dof 14   d  9.71111111e-01
+Node          22 (      22):
+  dof 14   d  9.71111111e-01
+Node          23 (      23):
+  dof 14   d  9.71111111e-01
+Node          24 (      24):
+  dof 14   d  9.71111111e-01
+
+
+
+
+Element output:
+---------------
+element 1 (       1) :
+  GP  1.1  :  state 9.8000e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+  GP  1.2  :  state 9.8000e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+  GP  1.3  :  state 9.8000e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+  GP  1.4  :  state 9.8000e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+element 2 (       2) :
+  GP  1.1  :  state 5.0000e-01   flow -0.0000e+00 2.2204e-21 -0.0000e+00
+  GP  1.2  :  state 5.0000e-01   flow -0.0000e+00 2.2204e-21 -0.0000e+00
+  GP  1.3  :  state 5.0000e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 5.0000e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+element 3 (       3) :
+  GP  1.1  :  state 9.7556e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.2  :  state 9.7556e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.3  :  state 9.7556e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 9.7556e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+element 4 (       4) :
+  GP  1.1  :  state 9.7556e-01   flow -0.0000e+00 -4.4409e-21 -0.0000e+00
+  GP  1.2  :  state 9.7556e-01   flow -0.0000e+00 -4.4409e-21 -0.0000e+00
+  GP  1.3  :  state 9.7556e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+  GP  1.4  :  state 9.7556e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+element 5 (       5) :
+  GP  1.1  :  state 9.7556e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.2  :  state 9.7556e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.3  :  state 9.7556e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 9.7556e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+element 6 (       6) :
+  GP  1.1  :  state 9.7556e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+  GP  1.2  :  state 9.7556e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+  GP  1.3  :  state 9.7556e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+  GP  1.4  :  state 9.7556e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+
+
+
+==============================================================
+Output for time 1.45000000e+01 
+==============================================================
+Output for domain   1
+
+
+DofManager output:
+------------------
+Node           1 (       1):
+  dof 14   d  9.80000000e-01
+Node           2 (       2):
+  dof 14   d  9.80000000e-01
+Node           3 (       3):
+  dof 14   d  9.80000000e-01
+Node           4 (       4):
+  dof 14   d  9.80000000e-01
+Node           5 (       5):
+  dof 14   d  5.00000000e-01
+Node           6 (       6):
+  dof 14   d  5.00000000e-01
+Node           7 (       7):
+  dof 14   d  5.00000000e-01
+Node           8 (       8):
+  dof 14   d  5.00000000e-01
+Node           9 (       9):
+  dof 14   d  9.44444444e-01
+Node          10 (      10):
+  dof 14   d  9.44444444e-01
+Node          11 (      11):
+  dof 14   d  9.44444444e-01
+Node          12 (      12):
+  dof 14   d  9.44444444e-01
+Node          13 (      13):
+  dof 14   d  9.44444444e-01
+Node          14 (      14):
+  dof 14   d  9.44444444e-01
+Node          15 (      15):
+  dof 14   d  9.44444444e-01
+Node          16 (      16):
+  dof 14   d  9.44444444e-01
+Node          17 (      17):
+  dof 14   d  9.44444444e-01
+Node          18 (      18):
+  dof 14   d  9.44444444e-01
+Node          19 (      19):
+  dof 14   d  9.44444444e-01
+Node          20 (      20):
+  dof 14   d  9.44444444e-01
+Node          21 (      21):
+  dof 14   d  9.44444444e-01
+Node          22 (      22):
+  dof 14   d  9.44444444e-01
+Node          23 (      23):
+  dof 14   d  9.44444444e-01
+Node          24 (      24):
+  dof 14   d  9.44444444e-01
+
+
+
+
+Element output:
+---------------
+element 1 (       1) :
+  GP  1.1  :  state 9.8000e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+  GP  1.2  :  state 9.8000e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+  GP  1.3  :  state 9.8000e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+  GP  1.4  :  state 9.8000e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+element 2 (       2) :
+  GP  1.1  :  state 5.0000e-01   flow -0.0000e+00 2.2204e-21 -0.0000e+00
+  GP  1.2  :  state 5.0000e-01   flow -0.0000e+00 2.2204e-21 -0.0000e+00
+  GP  1.3  :  state 5.0000e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 5.0000e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+element 3 (       3) :
+  GP  1.1  :  state 9.5778e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+  GP  1.2  :  state 9.5778e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+  GP  1.3  :  state 9.5778e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+  GP  1.4  :  state 9.5778e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+element 4 (       4) :
+  GP  1.1  :  state 9.5778e-01   flow -0.0000e+00 -4.4409e-21 -0.0000e+00
+  GP  1.2  :  state 9.5778e-01   flow -0.0000e+00 -4.4409e-21 -0.0000e+00
+  GP  1.3  :  state 9.5778e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 9.5778e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+element 5 (       5) :
+  GP  1.1  :  state 9.5778e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+  GP  1.2  :  state 9.5778e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+  GP  1.3  :  state 9.5778e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+  GP  1.4  :  state 9.5778e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+element 6 (       6) :
+  GP  1.1  :  state 9.5778e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.2  :  state 9.5778e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.3  :  state 9.5778e-01   flow -0.0000e+00 8.8818e-21 -0.0000e+00
+  GP  1.4  :  state 9.5778e-01   flow -0.0000e+00 8.8818e-21 -0.0000e+00
+
+
+
+==============================================================
+Output for time 1.50000000e+01 
+==============================================================
+Output for domain   1
+
+
+DofManager output:
+------------------
+Node           1 (       1):
+  dof 14   d  9.80000000e-01
+Node           2 (       2):
+  dof 14   d  9.80000000e-01
+Node           3 (       3):
+  dof 14   d  9.80000000e-01
+Node           4 (       4):
+  dof 14   d  9.80000000e-01
+Node           5 (       5):
+  dof 14   d  5.00000000e-01
+Node           6 (       6):
+  dof 14   d  5.00000000e-01
+Node           7 (       7):
+  dof 14   d  5.00000000e-01
+Node           8 (       8):
+  dof 14   d  5.00000000e-01
+Node           9 (       9):
+  dof 14   d  9.00000000e-01
+Node          10 (      10):
+  dof 14   d  9.00000000e-01
+Node          11 (      11):
+  dof 14   d  9.00000000e-01
+Node          12 (      12):
+  dof 14   d  9.00000000e-01
+Node          13 (      13):
+  dof 14   d  9.00000000e-01
+Node          14 (      14):
+  dof 14   d  9.00000000e-01
+Node          15 (      15):
+  dof 14   d  9.00000000e-01
+Node          16 (      16):
+  dof 14   d  9.00000000e-01
+Node          17 (      17):
+  dof 14   d  9.00000000e-01
+Node          18 (      18):
+  dof 14   d  9.00000000e-01
+Node          19 (      19):
+  dof 14   d  9.00000000e-01
+Node          20 (      20):
+  dof 14   d  9.00000000e-01
+Node          21 (      21):
+  dof 14   d  9.00000000e-01
+Node          22 (      22):
+  dof 14   d  9.00000000e-01
+Node          23 (      23):
+  dof 14   d  9.00000000e-01
+Node          24 (      24):
+  dof 14   d  9.00000000e-01
+
+
+
+
+Element output:
+---------------
+element 1 (       1) :
+  GP  1.1  :  state 9.8000e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+  GP  1.2  :  state 9.8000e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+  GP  1.3  :  state 9.8000e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+  GP  1.4  :  state 9.8000e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+element 2 (       2) :
+  GP  1.1  :  state 5.0000e-01   flow -0.0000e+00 2.2204e-21 -0.0000e+00
+  GP  1.2  :  state 5.0000e-01   flow -0.0000e+00 2.2204e-21 -0.0000e+00
+  GP  1.3  :  state 5.0000e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 5.0000e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+element 3 (       3) :
+  GP  1.1  :  state 9.2222e-01   flow -0.0000e+00 6.6613e-21 -0.0000e+00
+  GP  1.2  :  state 9.2222e-01   flow -0.0000e+00 6.6613e-21 -0.0000e+00
+  GP  1.3  :  state 9.2222e-01   flow -0.0000e+00 8.8818e-21 -0.0000e+00
+  GP  1.4  :  state 9.2222e-01   flow -0.0000e+00 8.8818e-21 -0.0000e+00
+element 4 (       4) :
+  GP  1.1  :  state 9.2222e-01   flow -0.0000e+00 -4.4409e-21 -0.0000e+00
+  GP  1.2  :  state 9.2222e-01   flow -0.0000e+00 -4.4409e-21 -0.0000e+00
+  GP  1.3  :  state 9.2222e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+  GP  1.4  :  state 9.2222e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+element 5 (       5) :
+  GP  1.1  :  state 9.2222e-01   flow -0.0000e+00 6.6613e-21 -0.0000e+00
+  GP  1.2  :  state 9.2222e-01   flow -0.0000e+00 6.6613e-21 -0.0000e+00
+  GP  1.3  :  state 9.2222e-01   flow -0.0000e+00 8.8818e-21 -0.0000e+00
+  GP  1.4  :  state 9.2222e-01   flow -0.0000e+00 8.8818e-21 -0.0000e+00
+element 6 (       6) :
+  GP  1.1  :  state 9.2222e-01   flow -0.0000e+00 4.4409e-21 -0.0000e+00
+  GP  1.2  :  state 9.2222e-01   flow -0.0000e+00 4.4409e-21 -0.0000e+00
+  GP  1.3  :  state 9.2222e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 9.2222e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+
+
+
+==============================================================
+Output for time 1.60000000e+01 
+==============================================================
+Output for domain   1
+
+
+DofManager output:
+------------------
+Node           1 (       1):
+  dof 14   d  9.80000000e-01
+Node           2 (       2):
+  dof 14   d  9.80000000e-01
+Node           3 (       3):
+  dof 14   d  9.80000000e-01
+Node           4 (       4):
+  dof 14   d  9.80000000e-01
+Node           5 (       5):
+  dof 14   d  5.00000000e-01
+Node           6 (       6):
+  dof 14   d  5.00000000e-01
+Node           7 (       7):
+  dof 14   d  5.00000000e-01
+Node           8 (       8):
+  dof 14   d  5.00000000e-01
+Node           9 (       9):
+  dof 14   d  8.88888889e-01
+Node          10 (      10):
+  dof 14   d  8.88888889e-01
+Node          11 (      11):
+  dof 14   d  8.88888889e-01
+Node          12 (      12):
+  dof 14   d  8.88888889e-01
+Node          13 (      13):
+  dof 14   d  8.88888889e-01
+Node          14 (      14):
+  dof 14   d  8.88888889e-01
+Node          15 (      15):
+  dof 14   d  8.88888889e-01
+Node          16 (      16):
+  dof 14   d  8.88888889e-01
+Node          17 (      17):
+  dof 14   d  8.88888889e-01
+Node          18 (      18):
+  dof 14   d  8.88888889e-01
+Node          19 (      19):
+  dof 14   d  8.88888889e-01
+Node          20 (      20):
+  dof 14   d  8.88888889e-01
+Node          21 (      21):
+  dof 14   d  8.88888889e-01
+Node          22 (      22):
+  dof 14   d  8.88888889e-01
+Node          23 (      23):
+  dof 14   d  8.88888889e-01
+Node          24 (      24):
+  dof 14   d  8.88888889e-01
+
+
+
+
+Element output:
+---------------
+element 1 (       1) :
+  GP  1.1  :  state 9.8000e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+  GP  1.2  :  state 9.8000e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+  GP  1.3  :  state 9.8000e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+  GP  1.4  :  state 9.8000e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+element 2 (       2) :
+  GP  1.1  :  state 5.0000e-01   flow -0.0000e+00 2.2204e-21 -0.0000e+00
+  GP  1.2  :  state 5.0000e-01   flow -0.0000e+00 2.2204e-21 -0.0000e+00
+  GP  1.3  :  state 5.0000e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 5.0000e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+element 3 (       3) :
+  GP  1.1  :  state 8.9444e-01   flow -0.0000e+00 2.2204e-21 -0.0000e+00
+  GP  1.2  :  state 8.9444e-01   flow -0.0000e+00 2.2204e-21 -0.0000e+00
+  GP  1.3  :  state 8.9444e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 8.9444e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+element 4 (       4) :
+  GP  1.1  :  state 8.9444e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+  GP  1.2  :  state 8.9444e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+  GP  1.3  :  state 8.9444e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+  GP  1.4  :  state 8.9444e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+element 5 (       5) :
+  GP  1.1  :  state 8.9444e-01   flow -0.0000e+00 2.2204e-21 -0.0000e+00
+  GP  1.2  :  state 8.9444e-01   flow -0.0000e+00 2.2204e-21 -0.0000e+00
+  GP  1.3  :  state 8.9444e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 8.9444e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+element 6 (       6) :
+  GP  1.1  :  state 8.9444e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.2  :  state 8.9444e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.3  :  state 8.9444e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 8.9444e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+
+
+
+==============================================================
+Output for time 1.90000000e+01 
+==============================================================
+Output for domain   1
+
+
+DofManager output:
+------------------
+Node           1 (       1):
+  dof 14   d  9.80000000e-01
+Node           2 (       2):
+  dof 14   d  9.80000000e-01
+Node           3 (       3):
+  dof 14   d  9.80000000e-01
+Node           4 (       4):
+  dof 14   d  9.80000000e-01
+Node           5 (       5):
+  dof 14   d  5.00000000e-01
+Node           6 (       6):
+  dof 14   d  5.00000000e-01
+Node           7 (       7):
+  dof 14   d  5.00000000e-01
+Node           8 (       8):
+  dof 14   d  5.00000000e-01
+Node           9 (       9):
+  dof 14   d  8.55555556e-01
+Node          10 (      10):
+  dof 14   d  8.55555556e-01
+Node          11 (      11):
+  dof 14   d  8.55555556e-01
+Node          12 (      12):
+  dof 14   d  8.55555556e-01
+Node          13 (      13):
+  dof 14   d  8.55555556e-01
+Node          14 (      14):
+  dof 14   d  8.55555556e-01
+Node          15 (      15):
+  dof 14   d  8.55555556e-01
+Node          16 (      16):
+  dof 14   d  8.55555556e-01
+Node          17 (      17):
+  dof 14   d  8.55555556e-01
+Node          18 (      18):
+  dof 14   d  8.55555556e-01
+Node          19 (      19):
+  dof 14   d  8.55555556e-01
+Node          20 (      20):
+  dof 14   d  8.55555556e-01
+Node          21 (      21):
+  dof 14   d  8.55555556e-01
+Node          22 (      22):
+  dof 14   d  8.55555556e-01
+Node          23 (      23):
+  dof 14   d  8.55555556e-01
+Node          24 (      24):
+  dof 14   d  8.55555556e-01
+
+
+
+
+Element output:
+---------------
+element 1 (       1) :
+  GP  1.1  :  state 9.8000e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+  GP  1.2  :  state 9.8000e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+  GP  1.3  :  state 9.8000e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+  GP  1.4  :  state 9.8000e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+element 2 (       2) :
+  GP  1.1  :  state 5.0000e-01   flow -0.0000e+00 2.2204e-21 -0.0000e+00
+  GP  1.2  :  state 5.0000e-01   flow -0.0000e+00 2.2204e-21 -0.0000e+00
+  GP  1.3  :  state 5.0000e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 5.0000e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+element 3 (       3) :
+  GP  1.1  :  state 8.7222e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.2  :  state 8.7222e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.3  :  state 8.7222e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 8.7222e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+element 4 (       4) :
+  GP  1.1  :  state 8.7222e-01   flow -0.0000e+00 -2.2204e-21 -0.0000e+00
+  GP  1.2  :  state 8.7222e-01   flow -0.0000e+00 -2.2204e-21 -0.0000e+00
+  GP  1.3  :  state 8.7222e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 8.7222e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+element 5 (       5) :
+  GP  1.1  :  state 8.7222e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.2  :  state 8.7222e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.3  :  state 8.7222e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 8.7222e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+element 6 (       6) :
+  GP  1.1  :  state 8.7222e-01   flow -0.0000e+00 4.4409e-21 -0.0000e+00
+  GP  1.2  :  state 8.7222e-01   flow -0.0000e+00 4.4409e-21 -0.0000e+00
+  GP  1.3  :  state 8.7222e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 8.7222e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+
+
+
+==============================================================
+Output for time 2.40000000e+01 
+==============================================================
+Output for domain   1
+
+
+DofManager output:
+------------------
+Node           1 (       1):
+  dof 14   d  9.80000000e-01
+Node           2 (       2):
+  dof 14   d  9.80000000e-01
+Node           3 (       3):
+  dof 14   d  9.80000000e-01
+Node           4 (       4):
+  dof 14   d  9.80000000e-01
+Node           5 (       5):
+  dof 14   d  5.00000000e-01
+Node           6 (       6):
+  dof 14   d  5.00000000e-01
+Node           7 (       7):
+  dof 14   d  5.00000000e-01
+Node           8 (       8):
+  dof 14   d  5.00000000e-01
+Node           9 (       9):
+  dof 14   d  8.00000000e-01
+Node          10 (      10):
+  dof 14   d  8.00000000e-01
+Node          11 (      11):
+  dof 14   d  8.00000000e-01
+Node          12 (      12):
+  dof 14   d  8.00000000e-01
+Node          13 (      13):
+  dof 14   d  8.00000000e-01
+Node          14 (      14):
+  dof 14   d  8.00000000e-01
+Node          15 (      15):
+  dof 14   d  8.00000000e-01
+Node          16 (      16):
+  dof 14   d  8.00000000e-01
+Node          17 (      17):
+  dof 14   d  8.00000000e-01
+Node          18 (      18):
+  dof 14   d  8.00000000e-01
+Node          19 (      19):
+  dof 14   d  8.00000000e-01
+Node          20 (      20):
+  dof 14   d  8.00000000e-01
+Node          21 (      21):
+  dof 14   d  8.00000000e-01
+Node          22 (      22):
+  dof 14   d  8.00000000e-01
+Node          23 (      23):
+  dof 14   d  8.00000000e-01
+Node          24 (      24):
+  dof 14   d  8.00000000e-01
+
+
+
+
+Element output:
+---------------
+element 1 (       1) :
+  GP  1.1  :  state 9.8000e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+  GP  1.2  :  state 9.8000e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+  GP  1.3  :  state 9.8000e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+  GP  1.4  :  state 9.8000e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+element 2 (       2) :
+  GP  1.1  :  state 5.0000e-01   flow -0.0000e+00 2.2204e-21 -0.0000e+00
+  GP  1.2  :  state 5.0000e-01   flow -0.0000e+00 2.2204e-21 -0.0000e+00
+  GP  1.3  :  state 5.0000e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 5.0000e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+element 3 (       3) :
+  GP  1.1  :  state 8.2778e-01   flow -0.0000e+00 -6.6613e-21 -0.0000e+00
+  GP  1.2  :  state 8.2778e-01   flow -0.0000e+00 -6.6613e-21 -0.0000e+00
+  GP  1.3  :  state 8.2778e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+  GP  1.4  :  state 8.2778e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+element 4 (       4) :
+  GP  1.1  :  state 8.2778e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.2  :  state 8.2778e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.3  :  state 8.2778e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 8.2778e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+element 5 (       5) :
+  GP  1.1  :  state 8.2778e-01   flow -0.0000e+00 -6.6613e-21 -0.0000e+00
+  GP  1.2  :  state 8.2778e-01   flow -0.0000e+00 -6.6613e-21 -0.0000e+00
+  GP  1.3  :  state 8.2778e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+  GP  1.4  :  state 8.2778e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+element 6 (       6) :
+  GP  1.1  :  state 8.2778e-01   flow -0.0000e+00 -2.2204e-21 -0.0000e+00
+  GP  1.2  :  state 8.2778e-01   flow -0.0000e+00 -2.2204e-21 -0.0000e+00
+  GP  1.3  :  state 8.2778e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 8.2778e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+
+
+
+==============================================================
+Output for time 3.40000000e+01 
+==============================================================
+Output for domain   1
+
+
+DofManager output:
+------------------
+Node           1 (       1):
+  dof 14   d  9.80000000e-01
+Node           2 (       2):
+  dof 14   d  9.80000000e-01
+Node           3 (       3):
+  dof 14   d  9.80000000e-01
+Node           4 (       4):
+  dof 14   d  9.80000000e-01
+Node           5 (       5):
+  dof 14   d  5.00000000e-01
+Node           6 (       6):
+  dof 14   d  5.00000000e-01
+Node           7 (       7):
+  dof 14   d  5.00000000e-01
+Node           8 (       8):
+  dof 14   d  5.00000000e-01
+Node           9 (       9):
+  dof 14   d  7.88888889e-01
+Node          10 (      10):
+  dof 14   d  7.88888889e-01
+Node          11 (      11):
+  dof 14   d  7.88888889e-01
+Node          12 (      12):
+  dof 14   d  7.88888889e-01
+Node          13 (      13):
+  dof 14   d  7.88888889e-01
+Node          14 (      14):
+  dof 14   d  7.88888889e-01
+Node          15 (      15):
+  dof 14   d  7.88888889e-01
+Node          16 (      16):
+  dof 14   d  7.88888889e-01
+Node          17 (      17):
+  dof 14   d  7.88888889e-01
+Node          18 (      18):
+  dof 14   d  7.88888889e-01
+Node          19 (      19):
+  dof 14   d  7.88888889e-01
+Node          20 (      20):
+  dof 14   d  7.88888889e-01
+Node          21 (      21):
+  dof 14   d  7.88888889e-01
+Node          22 (      22):
+  dof 14   d  7.88888889e-01
+Node          23 (      23):
+  dof 14   d  7.88888889e-01
+Node          24 (      24):
+  dof 14   d  7.88888889e-01
+
+
+
+
+Element output:
+---------------
+element 1 (       1) :
+  GP  1.1  :  state 9.8000e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+  GP  1.2  :  state 9.8000e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+  GP  1.3  :  state 9.8000e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+  GP  1.4  :  state 9.8000e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+element 2 (       2) :
+  GP  1.1  :  state 5.0000e-01   flow -0.0000e+00 2.2204e-21 -0.0000e+00
+  GP  1.2  :  state 5.0000e-01   flow -0.0000e+00 2.2204e-21 -0.0000e+00
+  GP  1.3  :  state 5.0000e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 5.0000e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+element 3 (       3) :
+  GP  1.1  :  state 7.9444e-01   flow -0.0000e+00 2.2204e-21 -0.0000e+00
+  GP  1.2  :  state 7.9444e-01   flow -0.0000e+00 2.2204e-21 -0.0000e+00
+  GP  1.3  :  state 7.9444e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 7.9444e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+element 4 (       4) :
+  GP  1.1  :  state 7.9444e-01   flow -0.0000e+00 2.2204e-21 -0.0000e+00
+  GP  1.2  :  state 7.9444e-01   flow -0.0000e+00 2.2204e-21 -0.0000e+00
+  GP  1.3  :  state 7.9444e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 7.9444e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+element 5 (       5) :
+  GP  1.1  :  state 7.9444e-01   flow -0.0000e+00 2.2204e-21 -0.0000e+00
+  GP  1.2  :  state 7.9444e-01   flow -0.0000e+00 2.2204e-21 -0.0000e+00
+  GP  1.3  :  state 7.9444e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 7.9444e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+element 6 (       6) :
+  GP  1.1  :  state 7.9444e-01   flow -0.0000e+00 -2.2204e-21 -0.0000e+00
+  GP  1.2  :  state 7.9444e-01   flow -0.0000e+00 -2.2204e-21 -0.0000e+00
+  GP  1.3  :  state 7.9444e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 7.9444e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+
+
+
+==============================================================
+Output for time 6.40000000e+01 
+==============================================================
+Output for domain   1
+
+
+DofManager output:
+------------------
+Node           1 (       1):
+  dof 14   d  9.80000000e-01
+Node           2 (       2):
+  dof 14   d  9.80000000e-01
+Node           3 (       3):
+  dof 14   d  9.80000000e-01
+Node           4 (       4):
+  dof 14   d  9.80000000e-01
+Node           5 (       5):
+  dof 14   d  5.00000000e-01
+Node           6 (       6):
+  dof 14   d  5.00000000e-01
+Node           7 (       7):
+  dof 14   d  5.00000000e-01
+Node           8 (       8):
+  dof 14   d  5.00000000e-01
+Node           9 (       9):
+  dof 14   d  7.55555556e-01
+Node          10 (      10):
+  dof 14   d  7.55555556e-01
+Node          11 (      11):
+  dof 14   d  7.55555556e-01
+Node          12 (      12):
+  dof 14   d  7.55555556e-01
+Node          13 (      13):
+  dof 14   d  7.55555556e-01
+Node          14 (      14):
+  dof 14   d  7.55555556e-01
+Node          15 (      15):
+  dof 14   d  7.55555556e-01
+Node          16 (      16):
+  dof 14   d  7.55555556e-01
+Node          17 (      17):
+  dof 14   d  7.55555556e-01
+Node          18 (      18):
+  dof 14   d  7.55555556e-01
+Node          19 (      19):
+  dof 14   d  7.55555556e-01
+Node          20 (      20):
+  dof 14   d  7.55555556e-01
+Node          21 (      21):
+  dof 14   d  7.55555556e-01
+Node          22 (      22):
+  dof 14   d  7.55555556e-01
+Node          23 (      23):
+  dof 14   d  7.55555556e-01
+Node          24 (      24):
+  dof 14   d  7.55555556e-01
+
+
+
+
+Element output:
+---------------
+element 1 (       1) :
+  GP  1.1  :  state 9.8000e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+  GP  1.2  :  state 9.8000e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+  GP  1.3  :  state 9.8000e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+  GP  1.4  :  state 9.8000e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+element 2 (       2) :
+  GP  1.1  :  state 5.0000e-01   flow -0.0000e+00 2.2204e-21 -0.0000e+00
+  GP  1.2  :  state 5.0000e-01   flow -0.0000e+00 2.2204e-21 -0.0000e+00
+  GP  1.3  :  state 5.0000e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 5.0000e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+element 3 (       3) :
+  GP  1.1  :  state 7.7222e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.2  :  state 7.7222e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.3  :  state 7.7222e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 7.7222e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+element 4 (       4) :
+  GP  1.1  :  state 7.7222e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.2  :  state 7.7222e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.3  :  state 7.7222e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 7.7222e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+element 5 (       5) :
+  GP  1.1  :  state 7.7222e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.2  :  state 7.7222e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.3  :  state 7.7222e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 7.7222e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+element 6 (       6) :
+  GP  1.1  :  state 7.7222e-01   flow -0.0000e+00 -4.4409e-21 -0.0000e+00
+  GP  1.2  :  state 7.7222e-01   flow -0.0000e+00 -4.4409e-21 -0.0000e+00
+  GP  1.3  :  state 7.7222e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 7.7222e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+
+
+
+==============================================================
+Output for time 1.14000000e+02 
+==============================================================
+Output for domain   1
+
+
+DofManager output:
+------------------
+Node           1 (       1):
+  dof 14   d  9.80000000e-01
+Node           2 (       2):
+  dof 14   d  9.80000000e-01
+Node           3 (       3):
+  dof 14   d  9.80000000e-01
+Node           4 (       4):
+  dof 14   d  9.80000000e-01
+Node           5 (       5):
+  dof 14   d  5.00000000e-01
+Node           6 (       6):
+  dof 14   d  5.00000000e-01
+Node           7 (       7):
+  dof 14   d  5.00000000e-01
+Node           8 (       8):
+  dof 14   d  5.00000000e-01
+Node           9 (       9):
+  dof 14   d  7.00000000e-01
+Node          10 (      10):
+  dof 14   d  7.00000000e-01
+Node          11 (      11):
+  dof 14   d  7.00000000e-01
+Node          12 (      12):
+  dof 14   d  7.00000000e-01
+Node          13 (      13):
+  dof 14   d  7.00000000e-01
+Node          14 (      14):
+  dof 14   d  7.00000000e-01
+Node          15 (      15):
+  dof 14   d  7.00000000e-01
+Node          16 (      16):
+  dof 14   d  7.00000000e-01
+Node          17 (      17):
+  dof 14   d  7.00000000e-01
+Node          18 (      18):
+  dof 14   d  7.00000000e-01
+Node          19 (      19):
+  dof 14   d  7.00000000e-01
+Node          20 (      20):
+  dof 14   d  7.00000000e-01
+Node          21 (      21):
+  dof 14   d  7.00000000e-01
+Node          22 (      22):
+  dof 14   d  7.00000000e-01
+Node          23 (      23):
+  dof 14   d  7.00000000e-01
+Node          24 (      24):
+  dof 14   d  7.00000000e-01
+
+
+
+
+Element output:
+---------------
+element 1 (       1) :
+  GP  1.1  :  state 9.8000e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+  GP  1.2  :  state 9.8000e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+  GP  1.3  :  state 9.8000e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+  GP  1.4  :  state 9.8000e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+element 2 (       2) :
+  GP  1.1  :  state 5.0000e-01   flow -0.0000e+00 2.2204e-21 -0.0000e+00
+  GP  1.2  :  state 5.0000e-01   flow -0.0000e+00 2.2204e-21 -0.0000e+00
+  GP  1.3  :  state 5.0000e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 5.0000e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+element 3 (       3) :
+  GP  1.1  :  state 7.2778e-01   flow -0.0000e+00 -2.2204e-21 -0.0000e+00
+  GP  1.2  :  state 7.2778e-01   flow -0.0000e+00 -2.2204e-21 -0.0000e+00
+  GP  1.3  :  state 7.2778e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 7.2778e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+element 4 (       4) :
+  GP  1.1  :  state 7.2778e-01   flow -0.0000e+00 -4.4409e-21 -0.0000e+00
+  GP  1.2  :  state 7.2778e-01   flow -0.0000e+00 -4.4409e-21 -0.0000e+00
+  GP  1.3  :  state 7.2778e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 7.2778e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+element 5 (       5) :
+  GP  1.1  :  state 7.2778e-01   flow -0.0000e+00 -2.2204e-21 -0.0000e+00
+  GP  1.2  :  state 7.2778e-01   flow -0.0000e+00 -2.2204e-21 -0.0000e+00
+  GP  1.3  :  state 7.2778e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 7.2778e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+element 6 (       6) :
+  GP  1.1  :  state 7.2778e-01   flow -0.0000e+00 -2.2204e-21 -0.0000e+00
+  GP  1.2  :  state 7.2778e-01   flow -0.0000e+00 -2.2204e-21 -0.0000e+00
+  GP  1.3  :  state 7.2778e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 7.2778e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+
+
+
+==============================================================
+Output for time 2.14000000e+02 
+==============================================================
+Output for domain   1
+
+
+DofManager output:
+------------------
+Node           1 (       1):
+  dof 14   d  9.80000000e-01
+Node           2 (       2):
+  dof 14   d  9.80000000e-01
+Node           3 (       3):
+  dof 14   d  9.80000000e-01
+Node           4 (       4):
+  dof 14   d  9.80000000e-01
+Node           5 (       5):
+  dof 14   d  5.00000000e-01
+Node           6 (       6):
+  dof 14   d  5.00000000e-01
+Node           7 (       7):
+  dof 14   d  5.00000000e-01
+Node           8 (       8):
+  dof 14   d  5.00000000e-01
+Node           9 (       9):
+  dof 14   d  6.88888889e-01
+Node          10 (      10):
+  dof 14   d  6.88888889e-01
+Node          11 (      11):
+  dof 14   d  6.88888889e-01
+Node          12 (      12):
+  dof 14   d  6.88888889e-01
+Node          13 (      13):
+  dof 14   d  6.88888889e-01
+Node          14 (      14):
+  dof 14   d  6.88888889e-01
+Node          15 (      15):
+  dof 14   d  6.88888889e-01
+Node          16 (      16):
+  dof 14   d  6.88888889e-01
+Node          17 (      17):
+  dof 14   d  6.88888889e-01
+Node          18 (      18):
+  dof 14   d  6.88888889e-01
+Node          19 (      19):
+  dof 14   d  6.88888889e-01
+Node          20 (      20):
+  dof 14   d  6.88888889e-01
+Node          21 (      21):
+  dof 14   d  6.88888889e-01
+Node          22 (      22):
+  dof 14   d  6.88888889e-01
+Node          23 (      23):
+  dof 14   d  6.88888889e-01
+Node          24 (      24):
+  dof 14   d  6.88888889e-01
+
+
+
+
+Element output:
+---------------
+element 1 (       1) :
+  GP  1.1  :  state 9.8000e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+  GP  1.2  :  state 9.8000e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+  GP  1.3  :  state 9.8000e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+  GP  1.4  :  state 9.8000e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+element 2 (       2) :
+  GP  1.1  :  state 5.0000e-01   flow -0.0000e+00 2.2204e-21 -0.0000e+00
+  GP  1.2  :  state 5.0000e-01   flow -0.0000e+00 2.2204e-21 -0.0000e+00
+  GP  1.3  :  state 5.0000e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 5.0000e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+element 3 (       3) :
+  GP  1.1  :  state 6.9444e-01   flow -0.0000e+00 -2.2204e-21 -0.0000e+00
+  GP  1.2  :  state 6.9444e-01   flow -0.0000e+00 -2.2204e-21 -0.0000e+00
+  GP  1.3  :  state 6.9444e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 6.9444e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+element 4 (       4) :
+  GP  1.1  :  state 6.9444e-01   flow -0.0000e+00 -2.2204e-21 -0.0000e+00
+  GP  1.2  :  state 6.9444e-01   flow -0.0000e+00 -2.2204e-21 -0.0000e+00
+  GP  1.3  :  state 6.9444e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 6.9444e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+element 5 (       5) :
+  GP  1.1  :  state 6.9444e-01   flow -0.0000e+00 -2.2204e-21 -0.0000e+00
+  GP  1.2  :  state 6.9444e-01   flow -0.0000e+00 -2.2204e-21 -0.0000e+00
+  GP  1.3  :  state 6.9444e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 6.9444e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+element 6 (       6) :
+  GP  1.1  :  state 6.9444e-01   flow -0.0000e+00 -2.2204e-21 -0.0000e+00
+  GP  1.2  :  state 6.9444e-01   flow -0.0000e+00 -2.2204e-21 -0.0000e+00
+  GP  1.3  :  state 6.9444e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+  GP  1.4  :  state 6.9444e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+
+
+
+==============================================================
+Output for time 5.14000000e+02 
+==============================================================
+Output for domain   1
+
+
+DofManager output:
+------------------
+Node           1 (       1):
+  dof 14   d  9.80000000e-01
+Node           2 (       2):
+  dof 14   d  9.80000000e-01
+Node           3 (       3):
+  dof 14   d  9.80000000e-01
+Node           4 (       4):
+  dof 14   d  9.80000000e-01
+Node           5 (       5):
+  dof 14   d  5.00000000e-01
+Node           6 (       6):
+  dof 14   d  5.00000000e-01
+Node           7 (       7):
+  dof 14   d  5.00000000e-01
+Node           8 (       8):
+  dof 14   d  5.00000000e-01
+Node           9 (       9):
+  dof 14   d  6.55555556e-01
+Node          10 (      10):
+  dof 14   d  6.55555556e-01
+Node          11 (      11):
+  dof 14   d  6.55555556e-01
+Node          12 (      12):
+  dof 14   d  6.55555556e-01
+Node          13 (      13):
+  dof 14   d  6.55555556e-01
+Node          14 (      14):
+  dof 14   d  6.55555556e-01
+Node          15 (      15):
+  dof 14   d  6.55555556e-01
+Node          16 (      16):
+  dof 14   d  6.55555556e-01
+Node          17 (      17):
+  dof 14   d  6.55555556e-01
+Node          18 (      18):
+  dof 14   d  6.55555556e-01
+Node          19 (      19):
+  dof 14   d  6.55555556e-01
+Node          20 (      20):
+  dof 14   d  6.55555556e-01
+Node          21 (      21):
+  dof 14   d  6.55555556e-01
+Node          22 (      22):
+  dof 14   d  6.55555556e-01
+Node          23 (      23):
+  dof 14   d  6.55555556e-01
+Node          24 (      24):
+  dof 14   d  6.55555556e-01
+
+
+
+
+Element output:
+---------------
+element 1 (       1) :
+  GP  1.1  :  state 9.8000e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+  GP  1.2  :  state 9.8000e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+  GP  1.3  :  state 9.8000e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+  GP  1.4  :  state 9.8000e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+element 2 (       2) :
+  GP  1.1  :  state 5.0000e-01   flow -0.0000e+00 2.2204e-21 -0.0000e+00
+  GP  1.2  :  state 5.0000e-01   flow -0.0000e+00 2.2204e-21 -0.0000e+00
+  GP  1.3  :  state 5.0000e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 5.0000e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+element 3 (       3) :
+  GP  1.1  :  state 6.7222e-01   flow -0.0000e+00 2.2204e-21 -0.0000e+00
+  GP  1.2  :  state 6.7222e-01   flow -0.0000e+00 2.2204e-21 -0.0000e+00
+  GP  1.3  :  state 6.7222e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 6.7222e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+element 4 (       4) :
+  GP  1.1  :  state 6.7222e-01   flow -0.0000e+00 2.2204e-21 -0.0000e+00
+  GP  1.2  :  state 6.7222e-01   flow -0.0000e+00 2.2204e-21 -0.0000e+00
+  GP  1.3  :  state 6.7222e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 6.7222e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+element 5 (       5) :
+  GP  1.1  :  state 6.7222e-01   flow -0.0000e+00 2.2204e-21 -0.0000e+00
+  GP  1.2  :  state 6.7222e-01   flow -0.0000e+00 2.2204e-21 -0.0000e+00
+  GP  1.3  :  state 6.7222e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 6.7222e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+element 6 (       6) :
+  GP  1.1  :  state 6.7222e-01   flow -0.0000e+00 2.2204e-21 -0.0000e+00
+  GP  1.2  :  state 6.7222e-01   flow -0.0000e+00 2.2204e-21 -0.0000e+00
+  GP  1.3  :  state 6.7222e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 6.7222e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+
+
+
+==============================================================
+Output for time 1.01400000e+03 
+==============================================================
+Output for domain   1
+
+
+DofManager output:
+------------------
+Node           1 (       1):
+  dof 14   d  9.80000000e-01
+Node           2 (       2):
+  dof 14   d  9.80000000e-01
+Node           3 (       3):
+  dof 14   d  9.80000000e-01
+Node           4 (       4):
+  dof 14   d  9.80000000e-01
+Node           5 (       5):
+  dof 14   d  5.00000000e-01
+Node           6 (       6):
+  dof 14   d  5.00000000e-01
+Node           7 (       7):
+  dof 14   d  5.00000000e-01
+Node           8 (       8):
+  dof 14   d  5.00000000e-01
+Node           9 (       9):
+  dof 14   d  6.00000000e-01
+Node          10 (      10):
+  dof 14   d  6.00000000e-01
+Node          11 (      11):
+  dof 14   d  6.00000000e-01
+Node          12 (      12):
+  dof 14   d  6.00000000e-01
+Node          13 (      13):
+  dof 14   d  6.00000000e-01
+Node          14 (      14):
+  dof 14   d  6.00000000e-01
+Node          15 (      15):
+  dof 14   d  6.00000000e-01
+Node          16 (      16):
+  dof 14   d  6.00000000e-01
+Node          17 (      17):
+  dof 14   d  6.00000000e-01
+Node          18 (      18):
+  dof 14   d  6.00000000e-01
+Node          19 (      19):
+  dof 14   d  6.00000000e-01
+Node          20 (      20):
+  dof 14   d  6.00000000e-01
+Node          21 (      21):
+  dof 14   d  6.00000000e-01
+Node          22 (      22):
+  dof 14   d  6.00000000e-01
+Node          23 (      23):
+  dof 14   d  6.00000000e-01
+Node          24 (      24):
+  dof 14   d  6.00000000e-01
+
+
+
+
+Element output:
+---------------
+element 1 (       1) :
+  GP  1.1  :  state 9.8000e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+  GP  1.2  :  state 9.8000e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+  GP  1.3  :  state 9.8000e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+  GP  1.4  :  state 9.8000e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+element 2 (       2) :
+  GP  1.1  :  state 5.0000e-01   flow -0.0000e+00 2.2204e-21 -0.0000e+00
+  GP  1.2  :  state 5.0000e-01   flow -0.0000e+00 2.2204e-21 -0.0000e+00
+  GP  1.3  :  state 5.0000e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 5.0000e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+element 3 (       3) :
+  GP  1.1  :  state 6.2778e-01   flow -0.0000e+00 -2.2204e-21 -0.0000e+00
+  GP  1.2  :  state 6.2778e-01   flow -0.0000e+00 -2.2204e-21 -0.0000e+00
+  GP  1.3  :  state 6.2778e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 6.2778e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+element 4 (       4) :
+  GP  1.1  :  state 6.2778e-01   flow -0.0000e+00 -2.2204e-21 -0.0000e+00
+  GP  1.2  :  state 6.2778e-01   flow -0.0000e+00 -2.2204e-21 -0.0000e+00
+  GP  1.3  :  state 6.2778e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 6.2778e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+element 5 (       5) :
+  GP  1.1  :  state 6.2778e-01   flow -0.0000e+00 -2.2204e-21 -0.0000e+00
+  GP  1.2  :  state 6.2778e-01   flow -0.0000e+00 -2.2204e-21 -0.0000e+00
+  GP  1.3  :  state 6.2778e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 6.2778e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+element 6 (       6) :
+  GP  1.1  :  state 6.2778e-01   flow -0.0000e+00 -2.2204e-21 -0.0000e+00
+  GP  1.2  :  state 6.2778e-01   flow -0.0000e+00 -2.2204e-21 -0.0000e+00
+  GP  1.3  :  state 6.2778e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 6.2778e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+
+
+
+==============================================================
+Output for time 2.01400000e+03 
+==============================================================
+Output for domain   1
+
+
+DofManager output:
+------------------
+Node           1 (       1):
+  dof 14   d  9.80000000e-01
+Node           2 (       2):
+  dof 14   d  9.80000000e-01
+Node           3 (       3):
+  dof 14   d  9.80000000e-01
+Node           4 (       4):
+  dof 14   d  9.80000000e-01
+Node           5 (       5):
+  dof 14   d  5.00000000e-01
+Node           6 (       6):
+  dof 14   d  5.00000000e-01
+Node           7 (       7):
+  dof 14   d  5.00000000e-01
+Node           8 (       8):
+  dof 14   d  5.00000000e-01
+Node           9 (       9):
+  dof 14   d  5.88888889e-01
+Node          10 (      10):
+  dof 14   d  5.88888889e-01
+Node          11 (      11):
+  dof 14   d  5.88888889e-01
+Node          12 (      12):
+  dof 14   d  5.88888889e-01
+Node          13 (      13):
+  dof 14   d  5.88888889e-01
+Node          14 (      14):
+  dof 14   d  5.88888889e-01
+Node          15 (      15):
+  dof 14   d  5.88888889e-01
+Node          16 (      16):
+  dof 14   d  5.88888889e-01
+Node          17 (      17):
+  dof 14   d  5.88888889e-01
+Node          18 (      18):
+  dof 14   d  5.88888889e-01
+Node          19 (      19):
+  dof 14   d  5.88888889e-01
+Node          20 (      20):
+  dof 14   d  5.88888889e-01
+Node          21 (      21):
+  dof 14   d  5.88888889e-01
+Node          22 (      22):
+  dof 14   d  5.88888889e-01
+Node          23 (      23):
+  dof 14   d  5.88888889e-01
+Node          24 (      24):
+  dof 14   d  5.88888889e-01
+
+
+
+
+Element output:
+---------------
+element 1 (       1) :
+  GP  1.1  :  state 9.8000e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+  GP  1.2  :  state 9.8000e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+  GP  1.3  :  state 9.8000e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+  GP  1.4  :  state 9.8000e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+element 2 (       2) :
+  GP  1.1  :  state 5.0000e-01   flow -0.0000e+00 2.2204e-21 -0.0000e+00
+  GP  1.2  :  state 5.0000e-01   flow -0.0000e+00 2.2204e-21 -0.0000e+00
+  GP  1.3  :  state 5.0000e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 5.0000e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+element 3 (       3) :
+  GP  1.1  :  state 5.9444e-01   flow -0.0000e+00 -2.2204e-21 -0.0000e+00
+  GP  1.2  :  state 5.9444e-01   flow -0.0000e+00 -2.2204e-21 -0.0000e+00
+  GP  1.3  :  state 5.9444e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 5.9444e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+element 4 (       4) :
+  GP  1.1  :  state 5.9444e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.2  :  state 5.9444e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.3  :  state 5.9444e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 5.9444e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+element 5 (       5) :
+  GP  1.1  :  state 5.9444e-01   flow -0.0000e+00 -2.2204e-21 -0.0000e+00
+  GP  1.2  :  state 5.9444e-01   flow -0.0000e+00 -2.2204e-21 -0.0000e+00
+  GP  1.3  :  state 5.9444e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 5.9444e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+element 6 (       6) :
+  GP  1.1  :  state 5.9444e-01   flow -0.0000e+00 4.4409e-21 -0.0000e+00
+  GP  1.2  :  state 5.9444e-01   flow -0.0000e+00 4.4409e-21 -0.0000e+00
+  GP  1.3  :  state 5.9444e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 5.9444e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+
+
+
+==============================================================
+Output for time 5.01400000e+03 
+==============================================================
+Output for domain   1
+
+
+DofManager output:
+------------------
+Node           1 (       1):
+  dof 14   d  9.80000000e-01
+Node           2 (       2):
+  dof 14   d  9.80000000e-01
+Node           3 (       3):
+  dof 14   d  9.80000000e-01
+Node           4 (       4):
+  dof 14   d  9.80000000e-01
+Node           5 (       5):
+  dof 14   d  5.00000000e-01
+Node           6 (       6):
+  dof 14   d  5.00000000e-01
+Node           7 (       7):
+  dof 14   d  5.00000000e-01
+Node           8 (       8):
+  dof 14   d  5.00000000e-01
+Node           9 (       9):
+  dof 14   d  5.55555556e-01
+Node          10 (      10):
+  dof 14   d  5.55555556e-01
+Node          11 (      11):
+  dof 14   d  5.55555556e-01
+Node          12 (      12):
+  dof 14   d  5.55555556e-01
+Node          13 (      13):
+  dof 14   d  5.55555556e-01
+Node          14 (      14):
+  dof 14   d  5.55555556e-01
+Node          15 (      15):
+  dof 14   d  5.55555556e-01
+Node          16 (      16):
+  dof 14   d  5.55555556e-01
+Node          17 (      17):
+  dof 14   d  5.55555556e-01
+Node          18 (      18):
+  dof 14   d  5.55555556e-01
+Node          19 (      19):
+  dof 14   d  5.55555556e-01
+Node          20 (      20):
+  dof 14   d  5.55555556e-01
+Node          21 (      21):
+  dof 14   d  5.55555556e-01
+Node          22 (      22):
+  dof 14   d  5.55555556e-01
+Node          23 (      23):
+  dof 14   d  5.55555556e-01
+Node          24 (      24):
+  dof 14   d  5.55555556e-01
+
+
+
+
+Element output:
+---------------
+element 1 (       1) :
+  GP  1.1  :  state 9.8000e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+  GP  1.2  :  state 9.8000e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+  GP  1.3  :  state 9.8000e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+  GP  1.4  :  state 9.8000e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+element 2 (       2) :
+  GP  1.1  :  state 5.0000e-01   flow -0.0000e+00 2.2204e-21 -0.0000e+00
+  GP  1.2  :  state 5.0000e-01   flow -0.0000e+00 2.2204e-21 -0.0000e+00
+  GP  1.3  :  state 5.0000e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 5.0000e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+element 3 (       3) :
+  GP  1.1  :  state 5.7222e-01   flow -0.0000e+00 4.4409e-21 -0.0000e+00
+  GP  1.2  :  state 5.7222e-01   flow -0.0000e+00 4.4409e-21 -0.0000e+00
+  GP  1.3  :  state 5.7222e-01   flow -0.0000e+00 8.8818e-21 -0.0000e+00
+  GP  1.4  :  state 5.7222e-01   flow -0.0000e+00 8.8818e-21 -0.0000e+00
+element 4 (       4) :
+  GP  1.1  :  state 5.7222e-01   flow -0.0000e+00 -2.2204e-21 -0.0000e+00
+  GP  1.2  :  state 5.7222e-01   flow -0.0000e+00 -2.2204e-21 -0.0000e+00
+  GP  1.3  :  state 5.7222e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 5.7222e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+element 5 (       5) :
+  GP  1.1  :  state 5.7222e-01   flow -0.0000e+00 4.4409e-21 -0.0000e+00
+  GP  1.2  :  state 5.7222e-01   flow -0.0000e+00 4.4409e-21 -0.0000e+00
+  GP  1.3  :  state 5.7222e-01   flow -0.0000e+00 8.8818e-21 -0.0000e+00
+  GP  1.4  :  state 5.7222e-01   flow -0.0000e+00 8.8818e-21 -0.0000e+00
+element 6 (       6) :
+  GP  1.1  :  state 5.7222e-01   flow -0.0000e+00 2.2204e-21 -0.0000e+00
+  GP  1.2  :  state 5.7222e-01   flow -0.0000e+00 2.2204e-21 -0.0000e+00
+  GP  1.3  :  state 5.7222e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 5.7222e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+
+
+
+==============================================================
+Output for time 1.00140000e+04 
+==============================================================
+Output for domain   1
+
+
+DofManager output:
+------------------
+Node           1 (       1):
+  dof 14   d  9.80000000e-01
+Node           2 (       2):
+  dof 14   d  9.80000000e-01
+Node           3 (       3):
+  dof 14   d  9.80000000e-01
+Node           4 (       4):
+  dof 14   d  9.80000000e-01
+Node           5 (       5):
+  dof 14   d  5.00000000e-01
+Node           6 (       6):
+  dof 14   d  5.00000000e-01
+Node           7 (       7):
+  dof 14   d  5.00000000e-01
+Node           8 (       8):
+  dof 14   d  5.00000000e-01
+Node           9 (       9):
+  dof 14   d  5.00000000e-01
+Node          10 (      10):
+  dof 14   d  5.00000000e-01
+Node          11 (      11):
+  dof 14   d  5.00000000e-01
+Node          12 (      12):
+  dof 14   d  5.00000000e-01
+Node          13 (      13):
+  dof 14   d  5.00000000e-01
+Node          14 (      14):
+  dof 14   d  5.00000000e-01
+Node          15 (      15):
+  dof 14   d  5.00000000e-01
+Node          16 (      16):
+  dof 14   d  5.00000000e-01
+Node          17 (      17):
+  dof 14   d  5.00000000e-01
+Node          18 (      18):
+  dof 14   d  5.00000000e-01
+Node          19 (      19):
+  dof 14   d  5.00000000e-01
+Node          20 (      20):
+  dof 14   d  5.00000000e-01
+Node          21 (      21):
+  dof 14   d  5.00000000e-01
+Node          22 (      22):
+  dof 14   d  5.00000000e-01
+Node          23 (      23):
+  dof 14   d  5.00000000e-01
+Node          24 (      24):
+  dof 14   d  5.00000000e-01
+
+
+
+
+Element output:
+---------------
+element 1 (       1) :
+  GP  1.1  :  state 9.8000e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+  GP  1.2  :  state 9.8000e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+  GP  1.3  :  state 9.8000e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+  GP  1.4  :  state 9.8000e-01   flow -0.0000e+00 -8.8818e-21 -0.0000e+00
+element 2 (       2) :
+  GP  1.1  :  state 5.0000e-01   flow -0.0000e+00 2.2204e-21 -0.0000e+00
+  GP  1.2  :  state 5.0000e-01   flow -0.0000e+00 2.2204e-21 -0.0000e+00
+  GP  1.3  :  state 5.0000e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 5.0000e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+element 3 (       3) :
+  GP  1.1  :  state 5.2778e-01   flow -0.0000e+00 -2.2204e-21 -0.0000e+00
+  GP  1.2  :  state 5.2778e-01   flow -0.0000e+00 -2.2204e-21 -0.0000e+00
+  GP  1.3  :  state 5.2778e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 5.2778e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+element 4 (       4) :
+  GP  1.1  :  state 5.2778e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.2  :  state 5.2778e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.3  :  state 5.2778e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 5.2778e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+element 5 (       5) :
+  GP  1.1  :  state 5.2778e-01   flow -0.0000e+00 -2.2204e-21 -0.0000e+00
+  GP  1.2  :  state 5.2778e-01   flow -0.0000e+00 -2.2204e-21 -0.0000e+00
+  GP  1.3  :  state 5.2778e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 5.2778e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+element 6 (       6) :
+  GP  1.1  :  state 5.2778e-01   flow -0.0000e+00 -4.4409e-21 -0.0000e+00
+  GP  1.2  :  state 5.2778e-01   flow -0.0000e+00 -4.4409e-21 -0.0000e+00
+  GP  1.3  :  state 5.2778e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 5.2778e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+
+
@@ -0,0 +1,3107 @@
+############################################################## www.oofem.org ###
+       ####    ####   ######  ######  #    #
+     #    #  #    #  #       #       ##  ##
+    #    #  #    #  #####   #####   # ## #
+   #    #  #    #  #       #       #    #
+  #    #  #    #  #       #       #    #   OOFEM ver. 2.6
+  ####    ####   #       ######  #    #    Copyright (C) 1994-2017 Borek Patzak
+################################################################################
+
+
+Starting analysis on: Sun Oct 18 13:03:58 2026
+
+tests on creep at variable temperature and relative humidity
+
+==============================================================
+Output for time 8.64000000e-06 
+==============================================================
+Output for domain   1
+
+
+DofManager output:
+------------------
+Node           1 (       1):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node           2 (       2):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node           3 (       3):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node           4 (       4):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node           5 (       5):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node           6 (       6):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node           7 (       7):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node           8 (       8):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node           9 (       9):
+  dof 10   d  3.48000000e+02
+  dof 14   d  1.00000000e+00
+Node          10 (      10):
+  dof 10   d  3.48000000e+02
+  dof 14   d  1.00000000e+00
+Node          11 (      11):
+  dof 10   d  3.48000000e+02
+  dof 14   d  1.00000000e+00
+Node          12 (      12):
+  dof 10   d  3.48000000e+02
+  dof 14   d  1.00000000e+00
+Node          13 (      13):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node          14 (      14):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node          15 (      15):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node          16 (      16):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node          17 (      17):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node          18 (      18):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node          19 (      19):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node          20 (      20):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node          21 (      21):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node          22 (      22):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node          23 (      23):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node          24 (      24):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+
+
+
+
+Element output:
+---------------
+element 1 (       1) :
+  GP  1.1  :  temperature 2.9800e+02   t_flux 0.0000e+00 2.2737e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.2  :  temperature 2.9800e+02   t_flux 0.0000e+00 2.2737e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.3  :  temperature 2.9800e+02   t_flux 0.0000e+00 4.5475e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.4  :  temperature 2.9800e+02   t_flux 0.0000e+00 4.5475e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+element 2 (       2) :
+  GP  1.1  :  temperature 2.9800e+02   t_flux 0.0000e+00 -1.1369e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 -1.1102e-20 0.0000e+00
+  GP  1.2  :  temperature 2.9800e+02   t_flux 0.0000e+00 -1.1369e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 -1.1102e-20 0.0000e+00
+  GP  1.3  :  temperature 2.9800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.4  :  temperature 2.9800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+element 3 (       3) :
+  GP  1.1  :  temperature 3.2300e+02   t_flux 0.0000e+00 2.2737e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 -1.1102e-20 0.0000e+00
+  GP  1.2  :  temperature 3.2300e+02   t_flux 0.0000e+00 2.2737e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 -1.1102e-20 0.0000e+00
+  GP  1.3  :  temperature 3.2300e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.4  :  temperature 3.2300e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+element 4 (       4) :
+  GP  1.1  :  temperature 2.9800e+02   t_flux 0.0000e+00 -1.1369e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.2  :  temperature 2.9800e+02   t_flux 0.0000e+00 -1.1369e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.3  :  temperature 2.9800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.4  :  temperature 2.9800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+element 5 (       5) :
+  GP  1.1  :  temperature 2.9800e+02   t_flux 0.0000e+00 -1.1369e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 -1.1102e-20 0.0000e+00
+  GP  1.2  :  temperature 2.9800e+02   t_flux 0.0000e+00 -1.1369e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 -1.1102e-20 0.0000e+00
+  GP  1.3  :  temperature 2.9800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.4  :  temperature 2.9800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+element 6 (       6) :
+  GP  1.1  :  temperature 2.9800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 1.1102e-20 0.0000e+00
+  GP  1.2  :  temperature 2.9800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 1.1102e-20 0.0000e+00
+  GP  1.3  :  temperature 2.9800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.4  :  temperature 2.9800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+
+
+
+==============================================================
+Output for time 8.64000000e+00 
+==============================================================
+Output for domain   1
+
+
+DofManager output:
+------------------
+Node           1 (       1):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node           2 (       2):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node           3 (       3):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node           4 (       4):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node           5 (       5):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node           6 (       6):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node           7 (       7):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node           8 (       8):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node           9 (       9):
+  dof 10   d  3.48000000e+02
+  dof 14   d  1.00000000e+00
+Node          10 (      10):
+  dof 10   d  3.48000000e+02
+  dof 14   d  1.00000000e+00
+Node          11 (      11):
+  dof 10   d  3.48000000e+02
+  dof 14   d  1.00000000e+00
+Node          12 (      12):
+  dof 10   d  3.48000000e+02
+  dof 14   d  1.00000000e+00
+Node          13 (      13):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node          14 (      14):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node          15 (      15):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node          16 (      16):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node          17 (      17):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node          18 (      18):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node          19 (      19):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node          20 (      20):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node          21 (      21):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node          22 (      22):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node          23 (      23):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node          24 (      24):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+
+
+
+
+Element output:
+---------------
+element 1 (       1) :
+  GP  1.1  :  temperature 2.9800e+02   t_flux 0.0000e+00 2.2737e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.2  :  temperature 2.9800e+02   t_flux 0.0000e+00 2.2737e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.3  :  temperature 2.9800e+02   t_flux 0.0000e+00 4.5475e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.4  :  temperature 2.9800e+02   t_flux 0.0000e+00 4.5475e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+element 2 (       2) :
+  GP  1.1  :  temperature 2.9800e+02   t_flux 0.0000e+00 -1.1369e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 -1.1102e-20 0.0000e+00
+  GP  1.2  :  temperature 2.9800e+02   t_flux 0.0000e+00 -1.1369e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 -1.1102e-20 0.0000e+00
+  GP  1.3  :  temperature 2.9800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.4  :  temperature 2.9800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+element 3 (       3) :
+  GP  1.1  :  temperature 3.4800e+02   t_flux 0.0000e+00 1.1369e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 -1.1102e-20 0.0000e+00
+  GP  1.2  :  temperature 3.4800e+02   t_flux 0.0000e+00 1.1369e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 -1.1102e-20 0.0000e+00
+  GP  1.3  :  temperature 3.4800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.4  :  temperature 3.4800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+element 4 (       4) :
+  GP  1.1  :  temperature 2.9800e+02   t_flux 0.0000e+00 -1.1369e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.2  :  temperature 2.9800e+02   t_flux 0.0000e+00 -1.1369e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.3  :  temperature 2.9800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.4  :  temperature 2.9800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+element 5 (       5) :
+  GP  1.1  :  temperature 2.9800e+02   t_flux 0.0000e+00 -1.1369e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 -1.1102e-20 0.0000e+00
+  GP  1.2  :  temperature 2.9800e+02   t_flux 0.0000e+00 -1.1369e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 -1.1102e-20 0.0000e+00
+  GP  1.3  :  temperature 2.9800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.4  :  temperature 2.9800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+element 6 (       6) :
+  GP  1.1  :  temperature 2.9800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 1.1102e-20 0.0000e+00
+  GP  1.2  :  temperature 2.9800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 1.1102e-20 0.0000e+00
+  GP  1.3  :  temperature 2.9800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.4  :  temperature 2.9800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+
+
+
+==============================================================
+Output for time 1.72800000e+01 
+==============================================================
+Output for domain   1
+
+
+DofManager output:
+------------------
+Node           1 (       1):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node           2 (       2):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node           3 (       3):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node           4 (       4):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node           5 (       5):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node           6 (       6):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node           7 (       7):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node           8 (       8):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node           9 (       9):
+  dof 10   d  3.48000000e+02
+  dof 14   d  1.00000000e+00
+Node          10 (      10):
+  dof 10   d  3.48000000e+02
+  dof 14   d  1.00000000e+00
+Node          11 (      11):
+  dof 10   d  3.48000000e+02
+  dof 14   d  1.00000000e+00
+Node          12 (      12):
+  dof 10   d  3.48000000e+02
+  dof 14   d  1.00000000e+00
+Node          13 (      13):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node          14 (      14):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node          15 (      15):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node          16 (      16):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node          17 (      17):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node          18 (      18):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node          19 (      19):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node          20 (      20):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node          21 (      21):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node          22 (      22):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node          23 (      23):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node          24 (      24):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+
+
+
+
+Element output:
+---------------
+element 1 (       1) :
+  GP  1.1  :  temperature 2.9800e+02   t_flux 0.0000e+00 2.2737e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.2  :  temperature 2.9800e+02   t_flux 0.0000e+00 2.2737e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.3  :  temperature 2.9800e+02   t_flux 0.0000e+00 4.5475e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.4  :  temperature 2.9800e+02   t_flux 0.0000e+00 4.5475e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+element 2 (       2) :
+  GP  1.1  :  temperature 2.9800e+02   t_flux 0.0000e+00 -1.1369e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 -1.1102e-20 0.0000e+00
+  GP  1.2  :  temperature 2.9800e+02   t_flux 0.0000e+00 -1.1369e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 -1.1102e-20 0.0000e+00
+  GP  1.3  :  temperature 2.9800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.4  :  temperature 2.9800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+element 3 (       3) :
+  GP  1.1  :  temperature 3.4800e+02   t_flux 0.0000e+00 1.1369e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 -1.1102e-20 0.0000e+00
+  GP  1.2  :  temperature 3.4800e+02   t_flux 0.0000e+00 1.1369e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 -1.1102e-20 0.0000e+00
+  GP  1.3  :  temperature 3.4800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.4  :  temperature 3.4800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+element 4 (       4) :
+  GP  1.1  :  temperature 2.9800e+02   t_flux 0.0000e+00 -1.1369e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.2  :  temperature 2.9800e+02   t_flux 0.0000e+00 -1.1369e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.3  :  temperature 2.9800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.4  :  temperature 2.9800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+element 5 (       5) :
+  GP  1.1  :  temperature 2.9800e+02   t_flux 0.0000e+00 -1.1369e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 -1.1102e-20 0.0000e+00
+  GP  1.2  :  temperature 2.9800e+02   t_flux 0.0000e+00 -1.1369e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 -1.1102e-20 0.0000e+00
+  GP  1.3  :  temperature 2.9800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.4  :  temperature 2.9800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+element 6 (       6) :
+  GP  1.1  :  temperature 2.9800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 1.1102e-20 0.0000e+00
+  GP  1.2  :  temperature 2.9800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 1.1102e-20 0.0000e+00
+  GP  1.3  :  temperature 2.9800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.4  :  temperature 2.9800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+
+
+
+==============================================================
+Output for time 4.32000000e+01 
+==============================================================
+Output for domain   1
+
+
+DofManager output:
+------------------
+Node           1 (       1):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node           2 (       2):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node           3 (       3):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node           4 (       4):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node           5 (       5):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node           6 (       6):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node           7 (       7):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node           8 (       8):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node           9 (       9):
+  dof 10   d  3.48000000e+02
+  dof 14   d  1.00000000e+00
+Node          10 (      10):
+  dof 10   d  3.48000000e+02
+  dof 14   d  1.00000000e+00
+Node          11 (      11):
+  dof 10   d  3.48000000e+02
+  dof 14   d  1.00000000e+00
+Node          12 (      12):
+  dof 10   d  3.48000000e+02
+  dof 14   d  1.00000000e+00
+Node          13 (      13):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node          14 (      14):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node          15 (      15):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node          16 (      16):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node          17 (      17):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node          18 (      18):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node          19 (      19):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node          20 (      20):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node          21 (      21):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node          22 (      22):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node          23 (      23):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node          24 (      24):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+
+
+
+
+Element output:
+---------------
+element 1 (       1) :
+  GP  1.1  :  temperature 2.9800e+02   t_flux 0.0000e+00 2.2737e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.2  :  temperature 2.9800e+02   t_flux 0.0000e+00 2.2737e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.3  :  temperature 2.9800e+02   t_flux 0.0000e+00 4.5475e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.4  :  temperature 2.9800e+02   t_flux 0.0000e+00 4.5475e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+element 2 (       2) :
+  GP  1.1  :  temperature 2.9800e+02   t_flux 0.0000e+00 -1.1369e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 -1.1102e-20 0.0000e+00
+  GP  1.2  :  temperature 2.9800e+02   t_flux 0.0000e+00 -1.1369e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 -1.1102e-20 0.0000e+00
+  GP  1.3  :  temperature 2.9800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.4  :  temperature 2.9800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+element 3 (       3) :
+  GP  1.1  :  temperature 3.4800e+02   t_flux 0.0000e+00 1.1369e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 -1.1102e-20 0.0000e+00
+  GP  1.2  :  temperature 3.4800e+02   t_flux 0.0000e+00 1.1369e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 -1.1102e-20 0.0000e+00
+  GP  1.3  :  temperature 3.4800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.4  :  temperature 3.4800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+element 4 (       4) :
+  GP  1.1  :  temperature 2.9800e+02   t_flux 0.0000e+00 -1.1369e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.2  :  temperature 2.9800e+02   t_flux 0.0000e+00 -1.1369e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.3  :  temperature 2.9800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.4  :  temperature 2.9800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+element 5 (       5) :
+  GP  1.1  :  temperature 2.9800e+02   t_flux 0.0000e+00 -1.1369e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 -1.1102e-20 0.0000e+00
+  GP  1.2  :  temperature 2.9800e+02   t_flux 0.0000e+00 -1.1369e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 -1.1102e-20 0.0000e+00
+  GP  1.3  :  temperature 2.9800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.4  :  temperature 2.9800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+element 6 (       6) :
+  GP  1.1  :  temperature 2.9800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 1.1102e-20 0.0000e+00
+  GP  1.2  :  temperature 2.9800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 1.1102e-20 0.0000e+00
+  GP  1.3  :  temperature 2.9800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.4  :  temperature 2.9800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+
+
+
+==============================================================
+Output for time 8.64000000e+01 
+==============================================================
+Output for domain   1
+
+
+DofManager output:
+------------------
+Node           1 (       1):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node           2 (       2):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node           3 (       3):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node           4 (       4):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node           5 (       5):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node           6 (       6):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node           7 (       7):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node           8 (       8):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node           9 (       9):
+  dof 10   d  3.48000000e+02
+  dof 14   d  1.00000000e+00
+Node          10 (      10):
+  dof 10   d  3.48000000e+02
+  dof 14   d  1.00000000e+00
+Node          11 (      11):
+  dof 10   d  3.48000000e+02
+  dof 14   d  1.00000000e+00
+Node          12 (      12):
+  dof 10   d  3.48000000e+02
+  dof 14   d  1.00000000e+00
+Node          13 (      13):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node          14 (      14):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node          15 (      15):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node          16 (      16):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node          17 (      17):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node          18 (      18):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node          19 (      19):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node          20 (      20):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node          21 (      21):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node          22 (      22):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node          23 (      23):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node          24 (      24):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+
+
+
+
+Element output:
+---------------
+element 1 (       1) :
+  GP  1.1  :  temperature 2.9800e+02   t_flux 0.0000e+00 2.2737e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.2  :  temperature 2.9800e+02   t_flux 0.0000e+00 2.2737e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.3  :  temperature 2.9800e+02   t_flux 0.0000e+00 4.5475e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.4  :  temperature 2.9800e+02   t_flux 0.0000e+00 4.5475e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+element 2 (       2) :
+  GP  1.1  :  temperature 2.9800e+02   t_flux 0.0000e+00 -1.1369e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 -1.1102e-20 0.0000e+00
+  GP  1.2  :  temperature 2.9800e+02   t_flux 0.0000e+00 -1.1369e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 -1.1102e-20 0.0000e+00
+  GP  1.3  :  temperature 2.9800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.4  :  temperature 2.9800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+element 3 (       3) :
+  GP  1.1  :  temperature 3.4800e+02   t_flux 0.0000e+00 1.1369e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 -1.1102e-20 0.0000e+00
+  GP  1.2  :  temperature 3.4800e+02   t_flux 0.0000e+00 1.1369e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 -1.1102e-20 0.0000e+00
+  GP  1.3  :  temperature 3.4800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.4  :  temperature 3.4800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+element 4 (       4) :
+  GP  1.1  :  temperature 2.9800e+02   t_flux 0.0000e+00 -1.1369e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.2  :  temperature 2.9800e+02   t_flux 0.0000e+00 -1.1369e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.3  :  temperature 2.9800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.4  :  temperature 2.9800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+element 5 (       5) :
+  GP  1.1  :  temperature 2.9800e+02   t_flux 0.0000e+00 -1.1369e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 -1.1102e-20 0.0000e+00
+  GP  1.2  :  temperature 2.9800e+02   t_flux 0.0000e+00 -1.1369e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 -1.1102e-20 0.0000e+00
+  GP  1.3  :  temperature 2.9800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.4  :  temperature 2.9800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+element 6 (       6) :
+  GP  1.1  :  temperature 2.9800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 1.1102e-20 0.0000e+00
+  GP  1.2  :  temperature 2.9800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 1.1102e-20 0.0000e+00
+  GP  1.3  :  temperature 2.9800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.4  :  temperature 2.9800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+
+
+
+==============================================================
+Output for time 1.72800000e+02 
+==============================================================
+Output for domain   1
+
+
+DofManager output:
+------------------
+Node           1 (       1):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node           2 (       2):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node           3 (       3):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node           4 (       4):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node           5 (       5):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node           6 (       6):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node           7 (       7):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node           8 (       8):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node           9 (       9):
+  dof 10   d  3.48000000e+02
+  dof 14   d  1.00000000e+00
+Node          10 (      10):
+  dof 10   d  3.48000000e+02
+  dof 14   d  1.00000000e+00
+Node          11 (      11):
+  dof 10   d  3.48000000e+02
+  dof 14   d  1.00000000e+00
+Node          12 (      12):
+  dof 10   d  3.48000000e+02
+  dof 14   d  1.00000000e+00
+Node          13 (      13):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node          14 (      14):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node          15 (      15):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node          16 (      16):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node          17 (      17):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node          18 (      18):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node          19 (      19):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node          20 (      20):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node          21 (      21):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node          22 (      22):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node          23 (      23):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node          24 (      24):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+
+
+
+
+Element output:
+---------------
+element 1 (       1) :
+  GP  1.1  :  temperature 2.9800e+02   t_flux 0.0000e+00 2.2737e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.2  :  temperature 2.9800e+02   t_flux 0.0000e+00 2.2737e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.3  :  temperature 2.9800e+02   t_flux 0.0000e+00 4.5475e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.4  :  temperature 2.9800e+02   t_flux 0.0000e+00 4.5475e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+element 2 (       2) :
+  GP  1.1  :  temperature 2.9800e+02   t_flux 0.0000e+00 -1.1369e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 -1.1102e-20 0.0000e+00
+  GP  1.2  :  temperature 2.9800e+02   t_flux 0.0000e+00 -1.1369e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 -1.1102e-20 0.0000e+00
+  GP  1.3  :  temperature 2.9800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.4  :  temperature 2.9800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+element 3 (       3) :
+  GP  1.1  :  temperature 3.4800e+02   t_flux 0.0000e+00 1.1369e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 -1.1102e-20 0.0000e+00
+  GP  1.2  :  temperature 3.4800e+02   t_flux 0.0000e+00 1.1369e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 -1.1102e-20 0.0000e+00
+  GP  1.3  :  temperature 3.4800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.4  :  temperature 3.4800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+element 4 (       4) :
+  GP  1.1  :  temperature 2.9800e+02   t_flux 0.0000e+00 -1.1369e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.2  :  temperature 2.9800e+02   t_flux 0.0000e+00 -1.1369e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.3  :  temperature 2.9800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.4  :  temperature 2.9800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+element 5 (       5) :
+  GP  1.1  :  temperature 2.9800e+02   t_flux 0.0000e+00 -1.1369e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 -1.1102e-20 0.0000e+00
+  GP  1.2  :  temperature 2.9800e+02   t_flux 0.0000e+00 -1.1369e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 -1.1102e-20 0.0000e+00
+  GP  1.3  :  temperature 2.9800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.4  :  temperature 2.9800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+element 6 (       6) :
+  GP  1.1  :  temperature 2.9800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 1.1102e-20 0.0000e+00
+  GP  1.2  :  temperature 2.9800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 1.1102e-20 0.0000e+00
+  GP  1.3  :  temperature 2.9800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.4  :  temperature 2.9800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+
+
+
+==============================================================
+Output for time 4.32000000e+02 
+==============================================================
+Output for domain   1
+
+
+DofManager output:
+------------------
+Node           1 (       1):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node           2 (       2):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node           3 (       3):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node           4 (       4):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node           5 (       5):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node           6 (       6):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node           7 (       7):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node           8 (       8):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node           9 (       9):
+  dof 10   d  3.48000000e+02
+  dof 14   d  1.00000000e+00
+Node          10 (      10):
+  dof 10   d  3.48000000e+02
+  dof 14   d  1.00000000e+00
+Node          11 (      11):
+  dof 10   d  3.48000000e+02
+  dof 14   d  1.00000000e+00
+Node          12 (      12):
+  dof 10   d  3.48000000e+02
+  dof 14   d  1.00000000e+00
+Node          13 (      13):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node          14 (      14):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node          15 (      15):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node          16 (      16):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node          17 (      17):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node          18 (      18):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node          19 (      19):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node          20 (      20):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node          21 (      21):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node          22 (      22):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node          23 (      23):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node          24 (      24):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+
+
+
+
+Element output:
+---------------
+element 1 (       1) :
+  GP  1.1  :  temperature 2.9800e+02   t_flux 0.0000e+00 2.2737e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.2  :  temperature 2.9800e+02   t_flux 0.0000e+00 2.2737e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.3  :  temperature 2.9800e+02   t_flux 0.0000e+00 4.5475e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.4  :  temperature 2.9800e+02   t_flux 0.0000e+00 4.5475e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+element 2 (       2) :
+  GP  1.1  :  temperature 2.9800e+02   t_flux 0.0000e+00 -1.1369e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 -1.1102e-20 0.0000e+00
+  GP  1.2  :  temperature 2.9800e+02   t_flux 0.0000e+00 -1.1369e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 -1.1102e-20 0.0000e+00
+  GP  1.3  :  temperature 2.9800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.4  :  temperature 2.9800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+element 3 (       3) :
+  GP  1.1  :  temperature 3.4800e+02   t_flux 0.0000e+00 1.1369e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 -1.1102e-20 0.0000e+00
+  GP  1.2  :  temperature 3.4800e+02   t_flux 0.0000e+00 1.1369e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 -1.1102e-20 0.0000e+00
+  GP  1.3  :  temperature 3.4800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.4  :  temperature 3.4800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+element 4 (       4) :
+  GP  1.1  :  temperature 2.9800e+02   t_flux 0.0000e+00 -1.1369e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.2  :  temperature 2.9800e+02   t_flux 0.0000e+00 -1.1369e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.3  :  temperature 2.9800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.4  :  temperature 2.9800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+element 5 (       5) :
+  GP  1.1  :  temperature 2.9800e+02   t_flux 0.0000e+00 -1.1369e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 -1.1102e-20 0.0000e+00
+  GP  1.2  :  temperature 2.9800e+02   t_flux 0.0000e+00 -1.1369e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 -1.1102e-20 0.0000e+00
+  GP  1.3  :  temperature 2.9800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.4  :  temperature 2.9800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+element 6 (       6) :
+  GP  1.1  :  temperature 2.9800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 1.1102e-20 0.0000e+00
+  GP  1.2  :  temperature 2.9800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 1.1102e-20 0.0000e+00
+  GP  1.3  :  temperature 2.9800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.4  :  temperature 2.9800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+
+
+
+==============================================================
+Output for time 8.64000000e+02 
+==============================================================
+Output for domain   1
+
+
+DofManager output:
+------------------
+Node           1 (       1):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node           2 (       2):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node           3 (       3):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node           4 (       4):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node           5 (       5):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node           6 (       6):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node           7 (       7):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node           8 (       8):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node           9 (       9):
+  dof 10   d  3.48000000e+02
+  dof 14   d  1.00000000e+00
+Node          10 (      10):
+  dof 10   d  3.48000000e+02
+  dof 14   d  1.00000000e+00
+Node          11 (      11):
+  dof 10   d  3.48000000e+02
+  dof 14   d  1.00000000e+00
+Node          12 (      12):
+  dof 10   d  3.48000000e+02
+  dof 14   d  1.00000000e+00
+Node          13 (      13):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node          14 (      14):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node          15 (      15):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node          16 (      16):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node          17 (      17):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node          18 (      18):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node          19 (      19):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node          20 (      20):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node          21 (      21):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node          22 (      22):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node          23 (      23):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node          24 (      24):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+
+
+
+
+Element output:
+---------------
+element 1 (       1) :
+  GP  1.1  :  temperature 2.9800e+02   t_flux 0.0000e+00 2.2737e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.2  :  temperature 2.9800e+02   t_flux 0.0000e+00 2.2737e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.3  :  temperature 2.9800e+02   t_flux 0.0000e+00 4.5475e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.4  :  temperature 2.9800e+02   t_flux 0.0000e+00 4.5475e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+element 2 (       2) :
+  GP  1.1  :  temperature 2.9800e+02   t_flux 0.0000e+00 -1.1369e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 -1.1102e-20 0.0000e+00
+  GP  1.2  :  temperature 2.9800e+02   t_flux 0.0000e+00 -1.1369e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 -1.1102e-20 0.0000e+00
+  GP  1.3  :  temperature 2.9800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.4  :  temperature 2.9800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+element 3 (       3) :
+  GP  1.1  :  temperature 3.4800e+02   t_flux 0.0000e+00 1.1369e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 -1.1102e-20 0.0000e+00
+  GP  1.2  :  temperature 3.4800e+02   t_flux 0.0000e+00 1.1369e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 -1.1102e-20 0.0000e+00
+  GP  1.3  :  temperature 3.4800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.4  :  temperature 3.4800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+element 4 (       4) :
+  GP  1.1  :  temperature 2.9800e+02   t_flux 0.0000e+00 -1.1369e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.2  :  temperature 2.9800e+02   t_flux 0.0000e+00 -1.1369e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.3  :  temperature 2.9800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.4  :  temperature 2.9800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+element 5 (       5) :
+  GP  1.1  :  temperature 2.9800e+02   t_flux 0.0000e+00 -1.1369e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 -1.1102e-20 0.0000e+00
+  GP  1.2  :  temperature 2.9800e+02   t_flux 0.0000e+00 -1.1369e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 -1.1102e-20 0.0000e+00
+  GP  1.3  :  temperature 2.9800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.4  :  temperature 2.9800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+element 6 (       6) :
+  GP  1.1  :  temperature 2.9800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 1.1102e-20 0.0000e+00
+  GP  1.2  :  temperature 2.9800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 1.1102e-20 0.0000e+00
+  GP  1.3  :  temperature 2.9800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.4  :  temperature 2.9800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+
+
+
+==============================================================
+Output for time 1.72800000e+03 
+==============================================================
+Output for domain   1
+
+
+DofManager output:
+------------------
+Node           1 (       1):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node           2 (       2):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node           3 (       3):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node           4 (       4):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node           5 (       5):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node           6 (       6):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node           7 (       7):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node           8 (       8):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node           9 (       9):
+  dof 10   d  3.48000000e+02
+  dof 14   d  1.00000000e+00
+Node          10 (      10):
+  dof 10   d  3.48000000e+02
+  dof 14   d  1.00000000e+00
+Node          11 (      11):
+  dof 10   d  3.48000000e+02
+  dof 14   d  1.00000000e+00
+Node          12 (      12):
+  dof 10   d  3.48000000e+02
+  dof 14   d  1.00000000e+00
+Node          13 (      13):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node          14 (      14):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node          15 (      15):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node          16 (      16):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node          17 (      17):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node          18 (      18):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node          19 (      19):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node          20 (      20):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node          21 (      21):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node          22 (      22):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node          23 (      23):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node          24 (      24):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+
+
+
+
+Element output:
+---------------
+element 1 (       1) :
+  GP  1.1  :  temperature 2.9800e+02   t_flux 0.0000e+00 2.2737e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.2  :  temperature 2.9800e+02   t_flux 0.0000e+00 2.2737e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.3  :  temperature 2.9800e+02   t_flux 0.0000e+00 4.5475e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.4  :  temperature 2.9800e+02   t_flux 0.0000e+00 4.5475e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+element 2 (       2) :
+  GP  1.1  :  temperature 2.9800e+02   t_flux 0.0000e+00 -1.1369e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 -1.1102e-20 0.0000e+00
+  GP  1.2  :  temperature 2.9800e+02   t_flux 0.0000e+00 -1.1369e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 -1.1102e-20 0.0000e+00
+  GP  1.3  :  temperature 2.9800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.4  :  temperature 2.9800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+element 3 (       3) :
+  GP  1.1  :  temperature 3.4800e+02   t_flux 0.0000e+00 1.1369e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 -1.1102e-20 0.0000e+00
+  GP  1.2  :  temperature 3.4800e+02   t_flux 0.0000e+00 1.1369e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 -1.1102e-20 0.0000e+00
+  GP  1.3  :  temperature 3.4800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.4  :  temperature 3.4800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+element 4 (       4) :
+  GP  1.1  :  temperature 2.9800e+02   t_flux 0.0000e+00 -1.1369e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.2  :  temperature 2.9800e+02   t_flux 0.0000e+00 -1.1369e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.3  :  temperature 2.9800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.4  :  temperature 2.9800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+element 5 (       5) :
+  GP  1.1  :  temperature 2.9800e+02   t_flux 0.0000e+00 -1.1369e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 -1.1102e-20 0.0000e+00
+  GP  1.2  :  temperature 2.9800e+02   t_flux 0.0000e+00 -1.1369e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 -1.1102e-20 0.0000e+00
+  GP  1.3  :  temperature 2.9800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.4  :  temperature 2.9800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+element 6 (       6) :
+  GP  1.1  :  temperature 2.9800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 1.1102e-20 0.0000e+00
+  GP  1.2  :  temperature 2.9800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 1.1102e-20 0.0000e+00
+  GP  1.3  :  temperature 2.9800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.4  :  temperature 2.9800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+
+
+
+==============================================================
+Output for time 4.32000000e+03 
+==============================================================
+Output for domain   1
+
+
+DofManager output:
+------------------
+Node           1 (       1):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node           2 (       2):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node           3 (       3):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node           4 (       4):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node           5 (       5):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node           6 (       6):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node           7 (       7):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node           8 (       8):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node           9 (       9):
+  dof 10   d  3.48000000e+02
+  dof 14   d  1.00000000e+00
+Node          10 (      10):
+  dof 10   d  3.48000000e+02
+  dof 14   d  1.00000000e+00
+Node          11 (      11):
+  dof 10   d  3.48000000e+02
+  dof 14   d  1.00000000e+00
+Node          12 (      12):
+  dof 10   d  3.48000000e+02
+  dof 14   d  1.00000000e+00
+Node          13 (      13):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node          14 (      14):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node          15 (      15):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node          16 (      16):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node          17 (      17):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node          18 (      18):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node          19 (      19):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node          20 (      20):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node          21 (      21):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node          22 (      22):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node          23 (      23):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node          24 (      24):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+
+
+
+
+Element output:
+---------------
+element 1 (       1) :
+  GP  1.1  :  temperature 2.9800e+02   t_flux 0.0000e+00 2.2737e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.2  :  temperature 2.9800e+02   t_flux 0.0000e+00 2.2737e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.3  :  temperature 2.9800e+02   t_flux 0.0000e+00 4.5475e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.4  :  temperature 2.9800e+02   t_flux 0.0000e+00 4.5475e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+element 2 (       2) :
+  GP  1.1  :  temperature 2.9800e+02   t_flux 0.0000e+00 -1.1369e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 -1.1102e-20 0.0000e+00
+  GP  1.2  :  temperature 2.9800e+02   t_flux 0.0000e+00 -1.1369e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 -1.1102e-20 0.0000e+00
+  GP  1.3  :  temperature 2.9800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.4  :  temperature 2.9800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+element 3 (       3) :
+  GP  1.1  :  temperature 3.4800e+02   t_flux 0.0000e+00 1.1369e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 -1.1102e-20 0.0000e+00
+  GP  1.2  :  temperature 3.4800e+02   t_flux 0.0000e+00 1.1369e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 -1.1102e-20 0.0000e+00
+  GP  1.3  :  temperature 3.4800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.4  :  temperature 3.4800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+element 4 (       4) :
+  GP  1.1  :  temperature 2.9800e+02   t_flux 0.0000e+00 -1.1369e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.2  :  temperature 2.9800e+02   t_flux 0.0000e+00 -1.1369e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.3  :  temperature 2.9800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.4  :  temperature 2.9800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+element 5 (       5) :
+  GP  1.1  :  temperature 2.9800e+02   t_flux 0.0000e+00 -1.1369e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 -1.1102e-20 0.0000e+00
+  GP  1.2  :  temperature 2.9800e+02   t_flux 0.0000e+00 -1.1369e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 -1.1102e-20 0.0000e+00
+  GP  1.3  :  temperature 2.9800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.4  :  temperature 2.9800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+element 6 (       6) :
+  GP  1.1  :  temperature 2.9800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 1.1102e-20 0.0000e+00
+  GP  1.2  :  temperature 2.9800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 1.1102e-20 0.0000e+00
+  GP  1.3  :  temperature 2.9800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.4  :  temperature 2.9800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+
+
+
+==============================================================
+Output for time 8.64000000e+03 
+==============================================================
+Output for domain   1
+
+
+DofManager output:
+------------------
+Node           1 (       1):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node           2 (       2):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node           3 (       3):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node           4 (       4):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node           5 (       5):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node           6 (       6):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node           7 (       7):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node           8 (       8):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node           9 (       9):
+  dof 10   d  3.48000000e+02
+  dof 14   d  1.00000000e+00
+Node          10 (      10):
+  dof 10   d  3.48000000e+02
+  dof 14   d  1.00000000e+00
+Node          11 (      11):
+  dof 10   d  3.48000000e+02
+  dof 14   d  1.00000000e+00
+Node          12 (      12):
+  dof 10   d  3.48000000e+02
+  dof 14   d  1.00000000e+00
+Node          13 (      13):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node          14 (      14):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node          15 (      15):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node          16 (      16):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node          17 (      17):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node          18 (      18):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node          19 (      19):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node          20 (      20):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node          21 (      21):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node          22 (      22):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node          23 (      23):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node          24 (      24):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+
+
+
+
+Element output:
+---------------
+element 1 (       1) :
+  GP  1.1  :  temperature 2.9800e+02   t_flux 0.0000e+00 2.2737e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.2  :  temperature 2.9800e+02   t_flux 0.0000e+00 2.2737e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.3  :  temperature 2.9800e+02   t_flux 0.0000e+00 4.5475e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.4  :  temperature 2.9800e+02   t_flux 0.0000e+00 4.5475e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+element 2 (       2) :
+  GP  1.1  :  temperature 2.9800e+02   t_flux 0.0000e+00 -1.1369e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 -1.1102e-20 0.0000e+00
+  GP  1.2  :  temperature 2.9800e+02   t_flux 0.0000e+00 -1.1369e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 -1.1102e-20 0.0000e+00
+  GP  1.3  :  temperature 2.9800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.4  :  temperature 2.9800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+element 3 (       3) :
+  GP  1.1  :  temperature 3.4800e+02   t_flux 0.0000e+00 1.1369e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 -1.1102e-20 0.0000e+00
+  GP  1.2  :  temperature 3.4800e+02   t_flux 0.0000e+00 1.1369e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 -1.1102e-20 0.0000e+00
+  GP  1.3  :  temperature 3.4800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.4  :  temperature 3.4800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+element 4 (       4) :
+  GP  1.1  :  temperature 2.9800e+02   t_flux 0.0000e+00 -1.1369e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.2  :  temperature 2.9800e+02   t_flux 0.0000e+00 -1.1369e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.3  :  temperature 2.9800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.4  :  temperature 2.9800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+element 5 (       5) :
+  GP  1.1  :  temperature 2.9800e+02   t_flux 0.0000e+00 -1.1369e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 -1.1102e-20 0.0000e+00
+  GP  1.2  :  temperature 2.9800e+02   t_flux 0.0000e+00 -1.1369e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 -1.1102e-20 0.0000e+00
+  GP  1.3  :  temperature 2.9800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.4  :  temperature 2.9800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+element 6 (       6) :
+  GP  1.1  :  temperature 2.9800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 1.1102e-20 0.0000e+00
+  GP  1.2  :  temperature 2.9800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 1.1102e-20 0.0000e+00
+  GP  1.3  :  temperature 2.9800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.4  :  temperature 2.9800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+
+
+
+==============================================================
+Output for time 1.72800000e+04 
+==============================================================
+Output for domain   1
+
+
+DofManager output:
+------------------
+Node           1 (       1):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node           2 (       2):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node           3 (       3):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node           4 (       4):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node           5 (       5):
+  dof 10   d  2.98000000e+02
+  dof 14   d  9.88888889e-01
+Node           6 (       6):
+  dof 10   d  2.98000000e+02
+  dof 14   d  9.88888889e-01
+Node           7 (       7):
+  dof 10   d  2.98000000e+02
+  dof 14   d  9.88888889e-01
+Node           8 (       8):
+  dof 10   d  2.98000000e+02
+  dof 14   d  9.88888889e-01
+Node           9 (       9):
+  dof 10   d  3.48000000e+02
+  dof 14   d  1.00000000e+00
+Node          10 (      10):
+  dof 10   d  3.48000000e+02
+  dof 14   d  1.00000000e+00
+Node          11 (      11):
+  dof 10   d  3.48000000e+02
+  dof 14   d  1.00000000e+00
+Node          12 (      12):
+  dof 10   d  3.48000000e+02
+  dof 14   d  1.00000000e+00
+Node          13 (      13):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node          14 (      14):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node          15 (      15):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node          16 (      16):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node          17 (      17):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node          18 (      18):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node          19 (      19):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node          20 (      20):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node          21 (      21):
+  dof 10   d  2.98000000e+02
+  dof 14   d  9.88888889e-01
+Node          22 (      22):
+  dof 10   d  2.98000000e+02
+  dof 14   d  9.88888889e-01
+Node          23 (      23):
+  dof 10   d  2.98000000e+02
+  dof 14   d  9.88888889e-01
+Node          24 (      24):
+  dof 10   d  2.98000000e+02
+  dof 14   d  9.88888889e-01
+
+
+
+
+Element output:
+---------------
+element 1 (       1) :
+  GP  1.1  :  temperature 2.9800e+02   t_flux 0.0000e+00 2.2737e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.2  :  temperature 2.9800e+02   t_flux 0.0000e+00 2.2737e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.3  :  temperature 2.9800e+02   t_flux 0.0000e+00 4.5475e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.4  :  temperature 2.9800e+02   t_flux 0.0000e+00 4.5475e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+element 2 (       2) :
+  GP  1.1  :  temperature 2.9800e+02   t_flux 0.0000e+00 -1.1369e-13 0.0000e+00  humidity 9.9444e-01   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.2  :  temperature 2.9800e+02   t_flux 0.0000e+00 -1.1369e-13 0.0000e+00  humidity 9.9444e-01   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.3  :  temperature 2.9800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 9.9444e-01   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.4  :  temperature 2.9800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 9.9444e-01   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+element 3 (       3) :
+  GP  1.1  :  temperature 3.4800e+02   t_flux 0.0000e+00 1.1369e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 -1.1102e-20 0.0000e+00
+  GP  1.2  :  temperature 3.4800e+02   t_flux 0.0000e+00 1.1369e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 -1.1102e-20 0.0000e+00
+  GP  1.3  :  temperature 3.4800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.4  :  temperature 3.4800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+element 4 (       4) :
+  GP  1.1  :  temperature 2.9800e+02   t_flux 0.0000e+00 -1.1369e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.2  :  temperature 2.9800e+02   t_flux 0.0000e+00 -1.1369e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.3  :  temperature 2.9800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.4  :  temperature 2.9800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+element 5 (       5) :
+  GP  1.1  :  temperature 2.9800e+02   t_flux 0.0000e+00 -1.1369e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 -1.1102e-20 0.0000e+00
+  GP  1.2  :  temperature 2.9800e+02   t_flux 0.0000e+00 -1.1369e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 -1.1102e-20 0.0000e+00
+  GP  1.3  :  temperature 2.9800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.4  :  temperature 2.9800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+element 6 (       6) :
+  GP  1.1  :  temperature 2.9800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 9.9444e-01   h_flux 0.0000e+00 2.2204e-20 0.0000e+00
+  GP  1.2  :  temperature 2.9800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 9.9444e-01   h_flux 0.0000e+00 2.2204e-20 0.0000e+00
+  GP  1.3  :  temperature 2.9800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 9.9444e-01   h_flux 0.0000e+00 2.2204e-20 0.0000e+00
+  GP  1.4  :  temperature 2.9800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 9.9444e-01   h_flux 0.0000e+00 2.2204e-20 0.0000e+00
+
+
+
+==============================================================
+Output for time 4.32000000e+04 
+==============================================================
+Output for domain   1
+
+
+DofManager output:
+------------------
+Node           1 (       1):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node           2 (       2):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node           3 (       3):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node           4 (       4):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node           5 (       5):
+  dof 10   d  2.98000000e+02
+  dof 14   d  9.55555556e-01
+Node           6 (       6):
+  dof 10   d  2.98000000e+02
+  dof 14   d  9.55555556e-01
+Node           7 (       7):
+  dof 10   d  2.98000000e+02
+  dof 14   d  9.55555556e-01
+Node           8 (       8):
+  dof 10   d  2.98000000e+02
+  dof 14   d  9.55555556e-01
+Node           9 (       9):
+  dof 10   d  3.48000000e+02
+  dof 14   d  1.00000000e+00
+Node          10 (      10):
+  dof 10   d  3.48000000e+02
+  dof 14   d  1.00000000e+00
+Node          11 (      11):
+  dof 10   d  3.48000000e+02
+  dof 14   d  1.00000000e+00
+Node          12 (      12):
+  dof 10   d  3.48000000e+02
+  dof 14   d  1.00000000e+00
+Node          13 (      13):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node          14 (      14):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node          15 (      15):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node          16 (      16):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node          17 (      17):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node          18 (      18):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node          19 (      19):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node          20 (      20):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node          21 (      21):
+  dof 10   d  2.98000000e+02
+  dof 14   d  9.55555556e-01
+Node          22 (      22):
+  dof 10   d  2.98000000e+02
+  dof 14   d  9.55555556e-01
+Node          23 (      23):
+  dof 10   d  2.98000000e+02
+  dof 14   d  9.55555556e-01
+Node          24 (      24):
+  dof 10   d  2.98000000e+02
+  dof 14   d  9.55555556e-01
+
+
+
+
+Element output:
+---------------
+element 1 (       1) :
+  GP  1.1  :  temperature 2.9800e+02   t_flux 0.0000e+00 2.2737e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.2  :  temperature 2.9800e+02   t_flux 0.0000e+00 2.2737e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.3  :  temperature 2.9800e+02   t_flux 0.0000e+00 4.5475e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.4  :  temperature 2.9800e+02   t_flux 0.0000e+00 4.5475e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+element 2 (       2) :
+  GP  1.1  :  temperature 2.9800e+02   t_flux 0.0000e+00 -1.1369e-13 0.0000e+00  humidity 9.7222e-01   h_flux 0.0000e+00 -1.1102e-20 0.0000e+00
+  GP  1.2  :  temperature 2.9800e+02   t_flux 0.0000e+00 -1.1369e-13 0.0000e+00  humidity 9.7222e-01   h_flux 0.0000e+00 -1.1102e-20 0.0000e+00
+  GP  1.3  :  temperature 2.9800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 9.7222e-01   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.4  :  temperature 2.9800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 9.7222e-01   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+element 3 (       3) :
+  GP  1.1  :  temperature 3.4800e+02   t_flux 0.0000e+00 1.1369e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 -1.1102e-20 0.0000e+00
+  GP  1.2  :  temperature 3.4800e+02   t_flux 0.0000e+00 1.1369e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 -1.1102e-20 0.0000e+00
+  GP  1.3  :  temperature 3.4800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.4  :  temperature 3.4800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+element 4 (       4) :
+  GP  1.1  :  temperature 2.9800e+02   t_flux 0.0000e+00 -1.1369e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.2  :  temperature 2.9800e+02   t_flux 0.0000e+00 -1.1369e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.3  :  temperature 2.9800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.4  :  temperature 2.9800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+element 5 (       5) :
+  GP  1.1  :  temperature 2.9800e+02   t_flux 0.0000e+00 -1.1369e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 -1.1102e-20 0.0000e+00
+  GP  1.2  :  temperature 2.9800e+02   t_flux 0.0000e+00 -1.1369e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 -1.1102e-20 0.0000e+00
+  GP  1.3  :  temperature 2.9800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.4  :  temperature 2.9800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+element 6 (       6) :
+  GP  1.1  :  temperature 2.9800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 9.7222e-01   h_flux 0.0000e+00 1.1102e-20 0.0000e+00
+  GP  1.2  :  temperature 2.9800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 9.7222e-01   h_flux 0.0000e+00 1.1102e-20 0.0000e+00
+  GP  1.3  :  temperature 2.9800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 9.7222e-01   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.4  :  temperature 2.9800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 9.7222e-01   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+
+
+
+==============================================================
+Output for time 8.64000000e+04 
+==============================================================
+Output for domain   1
+
+
+DofManager output:
+------------------
+Node           1 (       1):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node           2 (       2):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node           3 (       3):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node           4 (       4):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node           5 (       5):
+  dof 10   d  2.98000000e+02
+  dof 14   d  9.00000000e-01
+Node           6 (       6):
+  dof 10   d  2.98000000e+02
+  dof 14   d  9.00000000e-01
+Node           7 (       7):
+  dof 10   d  2.98000000e+02
+  dof 14   d  9.00000000e-01
+Node           8 (       8):
+  dof 10   d  2.98000000e+02
+  dof 14   d  9.00000000e-01
+Node           9 (       9):
+  dof 10   d  3.48000000e+02
+  dof 14   d  1.00000000e+00
+Node          10 (      10):
+  dof 10   d  3.48000000e+02
+  dof 14   d  1.00000000e+00
+Node          11 (      11):
+  dof 10   d  3.48000000e+02
+  dof 14   d  1.00000000e+00
+Node          12 (      12):
+  dof 10   d  3.48000000e+02
+  dof 14   d  1.00000000e+00
+Node          13 (      13):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node          14 (      14):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node          15 (      15):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node          16 (      16):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node          17 (      17):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node          18 (      18):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node          19 (      19):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node          20 (      20):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node          21 (      21):
+  dof 10   d  2.98000000e+02
+  dof 14   d  9.00000000e-01
+Node          22 (      22):
+  dof 10   d  2.98000000e+02
+  dof 14   d  9.00000000e-01
+Node          23 (      23):
+  dof 10   d  2.98000000e+02
+  dof 14   d  9.00000000e-01
+Node          24 (      24):
+  dof 10   d  2.98000000e+02
+  dof 14   d  9.00000000e-01
+
+
+
+
+Element output:
+---------------
+element 1 (       1) :
+  GP  1.1  :  temperature 2.9800e+02   t_flux 0.0000e+00 2.2737e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.2  :  temperature 2.9800e+02   t_flux 0.0000e+00 2.2737e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.3  :  temperature 2.9800e+02   t_flux 0.0000e+00 4.5475e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.4  :  temperature 2.9800e+02   t_flux 0.0000e+00 4.5475e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+element 2 (       2) :
+  GP  1.1  :  temperature 2.9800e+02   t_flux 0.0000e+00 -1.1369e-13 0.0000e+00  humidity 9.2778e-01   h_flux 0.0000e+00 1.6653e-20 0.0000e+00
+  GP  1.2  :  temperature 2.9800e+02   t_flux 0.0000e+00 -1.1369e-13 0.0000e+00  humidity 9.2778e-01   h_flux 0.0000e+00 1.6653e-20 0.0000e+00
+  GP  1.3  :  temperature 2.9800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 9.2778e-01   h_flux 0.0000e+00 2.2204e-20 0.0000e+00
+  GP  1.4  :  temperature 2.9800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 9.2778e-01   h_flux 0.0000e+00 2.2204e-20 0.0000e+00
+element 3 (       3) :
+  GP  1.1  :  temperature 3.4800e+02   t_flux 0.0000e+00 1.1369e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 -1.1102e-20 0.0000e+00
+  GP  1.2  :  temperature 3.4800e+02   t_flux 0.0000e+00 1.1369e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 -1.1102e-20 0.0000e+00
+  GP  1.3  :  temperature 3.4800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.4  :  temperature 3.4800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+element 4 (       4) :
+  GP  1.1  :  temperature 2.9800e+02   t_flux 0.0000e+00 -1.1369e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.2  :  temperature 2.9800e+02   t_flux 0.0000e+00 -1.1369e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.3  :  temperature 2.9800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.4  :  temperature 2.9800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+element 5 (       5) :
+  GP  1.1  :  temperature 2.9800e+02   t_flux 0.0000e+00 -1.1369e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 -1.1102e-20 0.0000e+00
+  GP  1.2  :  temperature 2.9800e+02   t_flux 0.0000e+00 -1.1369e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 -1.1102e-20 0.0000e+00
+  GP  1.3  :  temperature 2.9800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.4  :  temperature 2.9800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+element 6 (       6) :
+  GP  1.1  :  temperature 2.9800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 9.2778e-01   h_flux 0.0000e+00 -2.2204e-20 0.0000e+00
+  GP  1.2  :  temperature 2.9800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 9.2778e-01   h_flux 0.0000e+00 -2.2204e-20 0.0000e+00
+  GP  1.3  :  temperature 2.9800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 9.2778e-01   h_flux 0.0000e+00 2.2204e-20 0.0000e+00
+  GP  1.4  :  temperature 2.9800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 9.2778e-01   h_flux 0.0000e+00 2.2204e-20 0.0000e+00
+
+
+
+==============================================================
+Output for time 1.72800000e+05 
+==============================================================
+Output for domain   1
+
+
+DofManager output:
+------------------
+Node           1 (       1):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node           2 (       2):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node           3 (       3):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node           4 (       4):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node           5 (       5):
+  dof 10   d  2.98000000e+02
+  dof 14   d  8.88888889e-01
+Node           6 (       6):
+  dof 10   d  2.98000000e+02
+  dof 14   d  8.88888889e-01
+Node           7 (       7):
+  dof 10   d  2.98000000e+02
+  dof 14   d  8.88888889e-01
+Node           8 (       8):
+  dof 10   d  2.98000000e+02
+  dof 14   d  8.88888889e-01
+Node           9 (       9):
+  dof 10   d  3.48000000e+02
+  dof 14   d  1.00000000e+00
+Node          10 (      10):
+  dof 10   d  3.48000000e+02
+  dof 14   d  1.00000000e+00
+Node          11 (      11):
+  dof 10   d  3.48000000e+02
+  dof 14   d  1.00000000e+00
+Node          12 (      12):
+  dof 10   d  3.48000000e+02
+  dof 14   d  1.00000000e+00
+Node          13 (      13):
+  dof 10   d  2.98222222e+02
+  dof 14   d  1.00000000e+00
+Node          14 (      14):
+  dof 10   d  2.98222222e+02
+  dof 14   d  1.00000000e+00
+Node          15 (      15):
+  dof 10   d  2.98222222e+02
+  dof 14   d  1.00000000e+00
+Node          16 (      16):
+  dof 10   d  2.98222222e+02
+  dof 14   d  1.00000000e+00
+Node          17 (      17):
+  dof 10   d  2.98222222e+02
+  dof 14   d  1.00000000e+00
+Node          18 (      18):
+  dof 10   d  2.98222222e+02
+  dof 14   d  1.00000000e+00
+Node          19 (      19):
+  dof 10   d  2.98222222e+02
+  dof 14   d  1.00000000e+00
+Node          20 (      20):
+  dof 10   d  2.98222222e+02
+  dof 14   d  1.00000000e+00
+Node          21 (      21):
+  dof 10   d  2.98222222e+02
+  dof 14   d  8.88888889e-01
+Node          22 (      22):
+  dof 10   d  2.98222222e+02
+  dof 14   d  8.88888889e-01
+Node          23 (      23):
+  dof 10   d  2.98222222e+02
+  dof 14   d  8.88888889e-01
+Node          24 (      24):
+  dof 10   d  2.98222222e+02
+  dof 14   d  8.88888889e-01
+
+
+
+
+Element output:
+---------------
+element 1 (       1) :
+  GP  1.1  :  temperature 2.9800e+02   t_flux 0.0000e+00 2.2737e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.2  :  temperature 2.9800e+02   t_flux 0.0000e+00 2.2737e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.3  :  temperature 2.9800e+02   t_flux 0.0000e+00 4.5475e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.4  :  temperature 2.9800e+02   t_flux 0.0000e+00 4.5475e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+element 2 (       2) :
+  GP  1.1  :  temperature 2.9800e+02   t_flux 0.0000e+00 -1.1369e-13 0.0000e+00  humidity 8.9444e-01   h_flux 0.0000e+00 -5.5508e-21 0.0000e+00
+  GP  1.2  :  temperature 2.9800e+02   t_flux 0.0000e+00 -1.1369e-13 0.0000e+00  humidity 8.9444e-01   h_flux 0.0000e+00 -5.5508e-21 0.0000e+00
+  GP  1.3  :  temperature 2.9800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 8.9444e-01   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.4  :  temperature 2.9800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 8.9444e-01   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+element 3 (       3) :
+  GP  1.1  :  temperature 3.4800e+02   t_flux 0.0000e+00 1.1369e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 -1.1102e-20 0.0000e+00
+  GP  1.2  :  temperature 3.4800e+02   t_flux 0.0000e+00 1.1369e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 -1.1102e-20 0.0000e+00
+  GP  1.3  :  temperature 3.4800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.4  :  temperature 3.4800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+element 4 (       4) :
+  GP  1.1  :  temperature 2.9811e+02   t_flux 0.0000e+00 -2.2737e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.2  :  temperature 2.9811e+02   t_flux 0.0000e+00 -2.2737e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.3  :  temperature 2.9811e+02   t_flux 0.0000e+00 -4.5475e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.4  :  temperature 2.9811e+02   t_flux 0.0000e+00 -4.5475e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+element 5 (       5) :
+  GP  1.1  :  temperature 2.9811e+02   t_flux 0.0000e+00 -1.1369e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 -1.1102e-20 0.0000e+00
+  GP  1.2  :  temperature 2.9811e+02   t_flux 0.0000e+00 -1.1369e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 -1.1102e-20 0.0000e+00
+  GP  1.3  :  temperature 2.9811e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.4  :  temperature 2.9811e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+element 6 (       6) :
+  GP  1.1  :  temperature 2.9811e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 8.9444e-01   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.2  :  temperature 2.9811e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 8.9444e-01   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.3  :  temperature 2.9811e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 8.9444e-01   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.4  :  temperature 2.9811e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 8.9444e-01   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+
+
+
+==============================================================
+Output for time 4.32000000e+05 
+==============================================================
+Output for domain   1
+
+
+DofManager output:
+------------------
+Node           1 (       1):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node           2 (       2):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node           3 (       3):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node           4 (       4):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node           5 (       5):
+  dof 10   d  2.98000000e+02
+  dof 14   d  8.55555556e-01
+Node           6 (       6):
+  dof 10   d  2.98000000e+02
+  dof 14   d  8.55555556e-01
+Node           7 (       7):
+  dof 10   d  2.98000000e+02
+  dof 14   d  8.55555556e-01
+Node           8 (       8):
+  dof 10   d  2.98000000e+02
+  dof 14   d  8.55555556e-01
+Node           9 (       9):
+  dof 10   d  3.48000000e+02
+  dof 14   d  1.00000000e+00
+Node          10 (      10):
+  dof 10   d  3.48000000e+02
+  dof 14   d  1.00000000e+00
+Node          11 (      11):
+  dof 10   d  3.48000000e+02
+  dof 14   d  1.00000000e+00
+Node          12 (      12):
+  dof 10   d  3.48000000e+02
+  dof 14   d  1.00000000e+00
+Node          13 (      13):
+  dof 10   d  2.98888889e+02
+  dof 14   d  1.00000000e+00
+Node          14 (      14):
+  dof 10   d  2.98888889e+02
+  dof 14   d  1.00000000e+00
+Node          15 (      15):
+  dof 10   d  2.98888889e+02
+  dof 14   d  1.00000000e+00
+Node          16 (      16):
+  dof 10   d  2.98888889e+02
+  dof 14   d  1.00000000e+00
+Node          17 (      17):
+  dof 10   d  2.98888889e+02
+  dof 14   d  1.00000000e+00
+Node          18 (      18):
+  dof 10   d  2.98888889e+02
+  dof 14   d  1.00000000e+00
+Node          19 (      19):
+  dof 10   d  2.98888889e+02
+  dof 14   d  1.00000000e+00
+Node          20 (      20):
+  dof 10   d  2.98888889e+02
+  dof 14   d  1.00000000e+00
+Node          21 (      21):
+  dof 10   d  2.98888889e+02
+  dof 14   d  8.55555556e-01
+Node          22 (      22):
+  dof 10   d  2.98888889e+02
+  dof 14   d  8.55555556e-01
+Node          23 (      23):
+  dof 10   d  2.98888889e+02
+  dof 14   d  8.55555556e-01
+Node          24 (      24):
+  dof 10   d  2.98888889e+02
+  dof 14   d  8.55555556e-01
+
+
+
+
+Element output:
+---------------
+element 1 (       1) :
+  GP  1.1  :  temperature 2.9800e+02   t_flux 0.0000e+00 2.2737e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.2  :  temperature 2.9800e+02   t_flux 0.0000e+00 2.2737e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.3  :  temperature 2.9800e+02   t_flux 0.0000e+00 4.5475e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.4  :  temperature 2.9800e+02   t_flux 0.0000e+00 4.5475e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+element 2 (       2) :
+  GP  1.1  :  temperature 2.9800e+02   t_flux 0.0000e+00 -1.1369e-13 0.0000e+00  humidity 8.7222e-01   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.2  :  temperature 2.9800e+02   t_flux 0.0000e+00 -1.1369e-13 0.0000e+00  humidity 8.7222e-01   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.3  :  temperature 2.9800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 8.7222e-01   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.4  :  temperature 2.9800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 8.7222e-01   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+element 3 (       3) :
+  GP  1.1  :  temperature 3.4800e+02   t_flux 0.0000e+00 1.1369e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 -1.1102e-20 0.0000e+00
+  GP  1.2  :  temperature 3.4800e+02   t_flux 0.0000e+00 1.1369e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 -1.1102e-20 0.0000e+00
+  GP  1.3  :  temperature 3.4800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.4  :  temperature 3.4800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+element 4 (       4) :
+  GP  1.1  :  temperature 2.9856e+02   t_flux 0.0000e+00 -1.1369e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.2  :  temperature 2.9856e+02   t_flux 0.0000e+00 -1.1369e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.3  :  temperature 2.9856e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.4  :  temperature 2.9856e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+element 5 (       5) :
+  GP  1.1  :  temperature 2.9856e+02   t_flux 0.0000e+00 -1.1369e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 -1.1102e-20 0.0000e+00
+  GP  1.2  :  temperature 2.9856e+02   t_flux 0.0000e+00 -1.1369e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 -1.1102e-20 0.0000e+00
+  GP  1.3  :  temperature 2.9856e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.4  :  temperature 2.9856e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+element 6 (       6) :
+  GP  1.1  :  temperature 2.9856e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 8.7222e-01   h_flux 0.0000e+00 -1.1090e-20 0.0000e+00
+  GP  1.2  :  temperature 2.9856e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 8.7222e-01   h_flux 0.0000e+00 -1.1090e-20 0.0000e+00
+  GP  1.3  :  temperature 2.9856e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 8.7222e-01   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.4  :  temperature 2.9856e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 8.7222e-01   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+
+
+
+==============================================================
+Output for time 8.64000000e+05 
+==============================================================
+Output for domain   1
+
+
+DofManager output:
+------------------
+Node           1 (       1):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node           2 (       2):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node           3 (       3):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node           4 (       4):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node           5 (       5):
+  dof 10   d  2.98000000e+02
+  dof 14   d  8.00000000e-01
+Node           6 (       6):
+  dof 10   d  2.98000000e+02
+  dof 14   d  8.00000000e-01
+Node           7 (       7):
+  dof 10   d  2.98000000e+02
+  dof 14   d  8.00000000e-01
+Node           8 (       8):
+  dof 10   d  2.98000000e+02
+  dof 14   d  8.00000000e-01
+Node           9 (       9):
+  dof 10   d  3.48000000e+02
+  dof 14   d  1.00000000e+00
+Node          10 (      10):
+  dof 10   d  3.48000000e+02
+  dof 14   d  1.00000000e+00
+Node          11 (      11):
+  dof 10   d  3.48000000e+02
+  dof 14   d  1.00000000e+00
+Node          12 (      12):
+  dof 10   d  3.48000000e+02
+  dof 14   d  1.00000000e+00
+Node          13 (      13):
+  dof 10   d  3.00000000e+02
+  dof 14   d  1.00000000e+00
+Node          14 (      14):
+  dof 10   d  3.00000000e+02
+  dof 14   d  1.00000000e+00
+Node          15 (      15):
+  dof 10   d  3.00000000e+02
+  dof 14   d  1.00000000e+00
+Node          16 (      16):
+  dof 10   d  3.00000000e+02
+  dof 14   d  1.00000000e+00
+Node          17 (      17):
+  dof 10   d  3.00000000e+02
+  dof 14   d  1.00000000e+00
+Node          18 (      18):
+  dof 10   d  3.00000000e+02
+  dof 14   d  1.00000000e+00
+Node          19 (      19):
+  dof 10   d  3.00000000e+02
+  dof 14   d  1.00000000e+00
+Node          20 (      20):
+  dof 10   d  3.00000000e+02
+  dof 14   d  1.00000000e+00
+Node          21 (      21):
+  dof 10   d  3.00000000e+02
+  dof 14   d  8.00000000e-01
+Node          22 (      22):
+  dof 10   d  3.00000000e+02
+  dof 14   d  8.00000000e-01
+Node          23 (      23):
+  dof 10   d  3.00000000e+02
+  dof 14   d  8.00000000e-01
+Node          24 (      24):
+  dof 10   d  3.00000000e+02
+  dof 14   d  8.00000000e-01
+
+
+
+
+Element output:
+---------------
+element 1 (       1) :
+  GP  1.1  :  temperature 2.9800e+02   t_flux 0.0000e+00 2.2737e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.2  :  temperature 2.9800e+02   t_flux 0.0000e+00 2.2737e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.3  :  temperature 2.9800e+02   t_flux 0.0000e+00 4.5475e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.4  :  temperature 2.9800e+02   t_flux 0.0000e+00 4.5475e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+element 2 (       2) :
+  GP  1.1  :  temperature 2.9800e+02   t_flux 0.0000e+00 -1.1369e-13 0.0000e+00  humidity 8.2778e-01   h_flux 0.0000e+00 1.5135e-20 0.0000e+00
+  GP  1.2  :  temperature 2.9800e+02   t_flux 0.0000e+00 -1.1369e-13 0.0000e+00  humidity 8.2778e-01   h_flux 0.0000e+00 1.5135e-20 0.0000e+00
+  GP  1.3  :  temperature 2.9800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 8.2778e-01   h_flux 0.0000e+00 2.0180e-20 0.0000e+00
+  GP  1.4  :  temperature 2.9800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 8.2778e-01   h_flux 0.0000e+00 2.0180e-20 0.0000e+00
+element 3 (       3) :
+  GP  1.1  :  temperature 3.4800e+02   t_flux 0.0000e+00 1.1369e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 -1.1102e-20 0.0000e+00
+  GP  1.2  :  temperature 3.4800e+02   t_flux 0.0000e+00 1.1369e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 -1.1102e-20 0.0000e+00
+  GP  1.3  :  temperature 3.4800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.4  :  temperature 3.4800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+element 4 (       4) :
+  GP  1.1  :  temperature 2.9944e+02   t_flux 0.0000e+00 -1.1369e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.2  :  temperature 2.9944e+02   t_flux 0.0000e+00 -1.1369e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.3  :  temperature 2.9944e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.4  :  temperature 2.9944e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+element 5 (       5) :
+  GP  1.1  :  temperature 2.9944e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 -1.1102e-20 0.0000e+00
+  GP  1.2  :  temperature 2.9944e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 -1.1102e-20 0.0000e+00
+  GP  1.3  :  temperature 2.9944e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.4  :  temperature 2.9944e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+element 6 (       6) :
+  GP  1.1  :  temperature 2.9944e+02   t_flux 0.0000e+00 1.1369e-13 0.0000e+00  humidity 8.2778e-01   h_flux 0.0000e+00 5.0451e-21 0.0000e+00
+  GP  1.2  :  temperature 2.9944e+02   t_flux 0.0000e+00 1.1369e-13 0.0000e+00  humidity 8.2778e-01   h_flux 0.0000e+00 5.0451e-21 0.0000e+00
+  GP  1.3  :  temperature 2.9944e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 8.2778e-01   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.4  :  temperature 2.9944e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 8.2778e-01   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+
+
+
+==============================================================
+Output for time 1.72800000e+06 
+==============================================================
+Output for domain   1
+
+
+DofManager output:
+------------------
+Node           1 (       1):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node           2 (       2):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node           3 (       3):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node           4 (       4):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node           5 (       5):
+  dof 10   d  2.98000000e+02
+  dof 14   d  7.88888889e-01
+Node           6 (       6):
+  dof 10   d  2.98000000e+02
+  dof 14   d  7.88888889e-01
+Node           7 (       7):
+  dof 10   d  2.98000000e+02
+  dof 14   d  7.88888889e-01
+Node           8 (       8):
+  dof 10   d  2.98000000e+02
+  dof 14   d  7.88888889e-01
+Node           9 (       9):
+  dof 10   d  3.48000000e+02
+  dof 14   d  1.00000000e+00
+Node          10 (      10):
+  dof 10   d  3.48000000e+02
+  dof 14   d  1.00000000e+00
+Node          11 (      11):
+  dof 10   d  3.48000000e+02
+  dof 14   d  1.00000000e+00
+Node          12 (      12):
+  dof 10   d  3.48000000e+02
+  dof 14   d  1.00000000e+00
+Node          13 (      13):
+  dof 10   d  3.03333333e+02
+  dof 14   d  1.00000000e+00
+Node          14 (      14):
+  dof 10   d  3.03333333e+02
+  dof 14   d  1.00000000e+00
+Node          15 (      15):
+  dof 10   d  3.03333333e+02
+  dof 14   d  1.00000000e+00
+Node          16 (      16):
+  dof 10   d  3.03333333e+02
+  dof 14   d  1.00000000e+00
+Node          17 (      17):
+  dof 10   d  3.03333333e+02
+  dof 14   d  1.00000000e+00
+Node          18 (      18):
+  dof 10   d  3.03333333e+02
+  dof 14   d  1.00000000e+00
+Node          19 (      19):
+  dof 10   d  3.03333333e+02
+  dof 14   d  1.00000000e+00
+Node          20 (      20):
+  dof 10   d  3.03333333e+02
+  dof 14   d  1.00000000e+00
+Node          21 (      21):
+  dof 10   d  3.03333333e+02
+  dof 14   d  7.88888889e-01
+Node          22 (      22):
+  dof 10   d  3.03333333e+02
+  dof 14   d  7.88888889e-01
+Node          23 (      23):
+  dof 10   d  3.03333333e+02
+  dof 14   d  7.88888889e-01
+Node          24 (      24):
+  dof 10   d  3.03333333e+02
+  dof 14   d  7.88888889e-01
+
+
+
+
+Element output:
+---------------
+element 1 (       1) :
+  GP  1.1  :  temperature 2.9800e+02   t_flux 0.0000e+00 2.2737e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.2  :  temperature 2.9800e+02   t_flux 0.0000e+00 2.2737e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.3  :  temperature 2.9800e+02   t_flux 0.0000e+00 4.5475e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.4  :  temperature 2.9800e+02   t_flux 0.0000e+00 4.5475e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+element 2 (       2) :
+  GP  1.1  :  temperature 2.9800e+02   t_flux 0.0000e+00 -1.1369e-13 0.0000e+00  humidity 7.9444e-01   h_flux 0.0000e+00 -2.3800e-21 0.0000e+00
+  GP  1.2  :  temperature 2.9800e+02   t_flux 0.0000e+00 -1.1369e-13 0.0000e+00  humidity 7.9444e-01   h_flux 0.0000e+00 -2.3800e-21 0.0000e+00
+  GP  1.3  :  temperature 2.9800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 7.9444e-01   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.4  :  temperature 2.9800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 7.9444e-01   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+element 3 (       3) :
+  GP  1.1  :  temperature 3.4800e+02   t_flux 0.0000e+00 1.1369e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 -1.1102e-20 0.0000e+00
+  GP  1.2  :  temperature 3.4800e+02   t_flux 0.0000e+00 1.1369e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 -1.1102e-20 0.0000e+00
+  GP  1.3  :  temperature 3.4800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.4  :  temperature 3.4800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+element 4 (       4) :
+  GP  1.1  :  temperature 3.0167e+02   t_flux 0.0000e+00 -1.1369e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.2  :  temperature 3.0167e+02   t_flux 0.0000e+00 -1.1369e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.3  :  temperature 3.0167e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.4  :  temperature 3.0167e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+element 5 (       5) :
+  GP  1.1  :  temperature 3.0167e+02   t_flux 0.0000e+00 -1.1369e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 -1.1102e-20 0.0000e+00
+  GP  1.2  :  temperature 3.0167e+02   t_flux 0.0000e+00 -1.1369e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 -1.1102e-20 0.0000e+00
+  GP  1.3  :  temperature 3.0167e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.4  :  temperature 3.0167e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+element 6 (       6) :
+  GP  1.1  :  temperature 3.0167e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 7.9444e-01   h_flux 0.0000e+00 2.3800e-21 0.0000e+00
+  GP  1.2  :  temperature 3.0167e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 7.9444e-01   h_flux 0.0000e+00 2.3800e-21 0.0000e+00
+  GP  1.3  :  temperature 3.0167e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 7.9444e-01   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.4  :  temperature 3.0167e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 7.9444e-01   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+
+
+
+==============================================================
+Output for time 4.32000000e+06 
+==============================================================
+Output for domain   1
+
+
+DofManager output:
+------------------
+Node           1 (       1):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node           2 (       2):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node           3 (       3):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node           4 (       4):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node           5 (       5):
+  dof 10   d  2.98000000e+02
+  dof 14   d  7.55555556e-01
+Node           6 (       6):
+  dof 10   d  2.98000000e+02
+  dof 14   d  7.55555556e-01
+Node           7 (       7):
+  dof 10   d  2.98000000e+02
+  dof 14   d  7.55555556e-01
+Node           8 (       8):
+  dof 10   d  2.98000000e+02
+  dof 14   d  7.55555556e-01
+Node           9 (       9):
+  dof 10   d  3.48000000e+02
+  dof 14   d  1.00000000e+00
+Node          10 (      10):
+  dof 10   d  3.48000000e+02
+  dof 14   d  1.00000000e+00
+Node          11 (      11):
+  dof 10   d  3.48000000e+02
+  dof 14   d  1.00000000e+00
+Node          12 (      12):
+  dof 10   d  3.48000000e+02
+  dof 14   d  1.00000000e+00
+Node          13 (      13):
+  dof 10   d  3.13333333e+02
+  dof 14   d  1.00000000e+00
+Node          14 (      14):
+  dof 10   d  3.13333333e+02
+  dof 14   d  1.00000000e+00
+Node          15 (      15):
+  dof 10   d  3.13333333e+02
+  dof 14   d  1.00000000e+00
+Node          16 (      16):
+  dof 10   d  3.13333333e+02
+  dof 14   d  1.00000000e+00
+Node          17 (      17):
+  dof 10   d  3.13333333e+02
+  dof 14   d  1.00000000e+00
+Node          18 (      18):
+  dof 10   d  3.13333333e+02
+  dof 14   d  1.00000000e+00
+Node          19 (      19):
+  dof 10   d  3.13333333e+02
+  dof 14   d  1.00000000e+00
+Node          20 (      20):
+  dof 10   d  3.13333333e+02
+  dof 14   d  1.00000000e+00
+Node          21 (      21):
+  dof 10   d  3.13333333e+02
+  dof 14   d  7.55555556e-01
+Node          22 (      22):
+  dof 10   d  3.13333333e+02
+  dof 14   d  7.55555556e-01
+Node          23 (      23):
+  dof 10   d  3.13333333e+02
+  dof 14   d  7.55555556e-01
+Node          24 (      24):
+  dof 10   d  3.13333333e+02
+  dof 14   d  7.55555556e-01
+
+
+
+
+Element output:
+---------------
+element 1 (       1) :
+  GP  1.1  :  temperature 2.9800e+02   t_flux 0.0000e+00 2.2737e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.2  :  temperature 2.9800e+02   t_flux 0.0000e+00 2.2737e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.3  :  temperature 2.9800e+02   t_flux 0.0000e+00 4.5475e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.4  :  temperature 2.9800e+02   t_flux 0.0000e+00 4.5475e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+element 2 (       2) :
+  GP  1.1  :  temperature 2.9800e+02   t_flux 0.0000e+00 -1.1369e-13 0.0000e+00  humidity 7.7222e-01   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.2  :  temperature 2.9800e+02   t_flux 0.0000e+00 -1.1369e-13 0.0000e+00  humidity 7.7222e-01   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.3  :  temperature 2.9800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 7.7222e-01   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.4  :  temperature 2.9800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 7.7222e-01   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+element 3 (       3) :
+  GP  1.1  :  temperature 3.4800e+02   t_flux 0.0000e+00 1.1369e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 -1.1102e-20 0.0000e+00
+  GP  1.2  :  temperature 3.4800e+02   t_flux 0.0000e+00 1.1369e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 -1.1102e-20 0.0000e+00
+  GP  1.3  :  temperature 3.4800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.4  :  temperature 3.4800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+element 4 (       4) :
+  GP  1.1  :  temperature 3.0833e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.2  :  temperature 3.0833e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.3  :  temperature 3.0833e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.4  :  temperature 3.0833e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+element 5 (       5) :
+  GP  1.1  :  temperature 3.0833e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 -1.1102e-20 0.0000e+00
+  GP  1.2  :  temperature 3.0833e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 -1.1102e-20 0.0000e+00
+  GP  1.3  :  temperature 3.0833e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.4  :  temperature 3.0833e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+element 6 (       6) :
+  GP  1.1  :  temperature 3.0833e+02   t_flux 0.0000e+00 1.1369e-13 0.0000e+00  humidity 7.7222e-01   h_flux 0.0000e+00 1.8679e-21 0.0000e+00
+  GP  1.2  :  temperature 3.0833e+02   t_flux 0.0000e+00 1.1369e-13 0.0000e+00  humidity 7.7222e-01   h_flux 0.0000e+00 1.8679e-21 0.0000e+00
+  GP  1.3  :  temperature 3.0833e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 7.7222e-01   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.4  :  temperature 3.0833e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 7.7222e-01   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+
+
+
+==============================================================
+Output for time 8.64000000e+06 
+==============================================================
+Output for domain   1
+
+
+DofManager output:
+------------------
+Node           1 (       1):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node           2 (       2):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node           3 (       3):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node           4 (       4):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node           5 (       5):
+  dof 10   d  2.98000000e+02
+  dof 14   d  7.00000000e-01
+Node           6 (       6):
+  dof 10   d  2.98000000e+02
+  dof 14   d  7.00000000e-01
+Node           7 (       7):
+  dof 10   d  2.98000000e+02
+  dof 14   d  7.00000000e-01
+Node           8 (       8):
+  dof 10   d  2.98000000e+02
+  dof 14   d  7.00000000e-01
+Node           9 (       9):
+  dof 10   d  3.48000000e+02
+  dof 14   d  1.00000000e+00
+Node          10 (      10):
+  dof 10   d  3.48000000e+02
+  dof 14   d  1.00000000e+00
+Node          11 (      11):
+  dof 10   d  3.48000000e+02
+  dof 14   d  1.00000000e+00
+Node          12 (      12):
+  dof 10   d  3.48000000e+02
+  dof 14   d  1.00000000e+00
+Node          13 (      13):
+  dof 10   d  3.30000000e+02
+  dof 14   d  1.00000000e+00
+Node          14 (      14):
+  dof 10   d  3.30000000e+02
+  dof 14   d  1.00000000e+00
+Node          15 (      15):
+  dof 10   d  3.30000000e+02
+  dof 14   d  1.00000000e+00
+Node          16 (      16):
+  dof 10   d  3.30000000e+02
+  dof 14   d  1.00000000e+00
+Node          17 (      17):
+  dof 10   d  3.30000000e+02
+  dof 14   d  1.00000000e+00
+Node          18 (      18):
+  dof 10   d  3.30000000e+02
+  dof 14   d  1.00000000e+00
+Node          19 (      19):
+  dof 10   d  3.30000000e+02
+  dof 14   d  1.00000000e+00
+Node          20 (      20):
+  dof 10   d  3.30000000e+02
+  dof 14   d  1.00000000e+00
+Node          21 (      21):
+  dof 10   d  3.30000000e+02
+  dof 14   d  7.00000000e-01
+Node          22 (      22):
+  dof 10   d  3.30000000e+02
+  dof 14   d  7.00000000e-01
+Node          23 (      23):
+  dof 10   d  3.30000000e+02
+  dof 14   d  7.00000000e-01
+Node          24 (      24):
+  dof 10   d  3.30000000e+02
+  dof 14   d  7.00000000e-01
+
+
+
+
+Element output:
+---------------
+element 1 (       1) :
+  GP  1.1  :  temperature 2.9800e+02   t_flux 0.0000e+00 2.2737e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.2  :  temperature 2.9800e+02   t_flux 0.0000e+00 2.2737e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.3  :  temperature 2.9800e+02   t_flux 0.0000e+00 4.5475e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.4  :  temperature 2.9800e+02   t_flux 0.0000e+00 4.5475e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+element 2 (       2) :
+  GP  1.1  :  temperature 2.9800e+02   t_flux 0.0000e+00 -1.1369e-13 0.0000e+00  humidity 7.2778e-01   h_flux 0.0000e+00 3.2878e-22 0.0000e+00
+  GP  1.2  :  temperature 2.9800e+02   t_flux 0.0000e+00 -1.1369e-13 0.0000e+00  humidity 7.2778e-01   h_flux 0.0000e+00 3.2878e-22 0.0000e+00
+  GP  1.3  :  temperature 2.9800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 7.2778e-01   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.4  :  temperature 2.9800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 7.2778e-01   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+element 3 (       3) :
+  GP  1.1  :  temperature 3.4800e+02   t_flux 0.0000e+00 1.1369e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 -1.1102e-20 0.0000e+00
+  GP  1.2  :  temperature 3.4800e+02   t_flux 0.0000e+00 1.1369e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 -1.1102e-20 0.0000e+00
+  GP  1.3  :  temperature 3.4800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.4  :  temperature 3.4800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+element 4 (       4) :
+  GP  1.1  :  temperature 3.2167e+02   t_flux 0.0000e+00 1.1369e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.2  :  temperature 3.2167e+02   t_flux 0.0000e+00 1.1369e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.3  :  temperature 3.2167e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.4  :  temperature 3.2167e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+element 5 (       5) :
+  GP  1.1  :  temperature 3.2167e+02   t_flux 0.0000e+00 1.1369e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 -1.1102e-20 0.0000e+00
+  GP  1.2  :  temperature 3.2167e+02   t_flux 0.0000e+00 1.1369e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 -1.1102e-20 0.0000e+00
+  GP  1.3  :  temperature 3.2167e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.4  :  temperature 3.2167e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+element 6 (       6) :
+  GP  1.1  :  temperature 3.2167e+02   t_flux 0.0000e+00 2.2737e-13 0.0000e+00  humidity 7.2778e-01   h_flux 0.0000e+00 3.2878e-22 0.0000e+00
+  GP  1.2  :  temperature 3.2167e+02   t_flux 0.0000e+00 2.2737e-13 0.0000e+00  humidity 7.2778e-01   h_flux 0.0000e+00 3.2878e-22 0.0000e+00
+  GP  1.3  :  temperature 3.2167e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 7.2778e-01   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.4  :  temperature 3.2167e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 7.2778e-01   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+
+
+
+==============================================================
+Output for time 1.72800000e+07 
+==============================================================
+Output for domain   1
+
+
+DofManager output:
+------------------
+Node           1 (       1):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node           2 (       2):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node           3 (       3):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node           4 (       4):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node           5 (       5):
+  dof 10   d  2.98000000e+02
+  dof 14   d  6.88888889e-01
+Node           6 (       6):
+  dof 10   d  2.98000000e+02
+  dof 14   d  6.88888889e-01
+Node           7 (       7):
+  dof 10   d  2.98000000e+02
+  dof 14   d  6.88888889e-01
+Node           8 (       8):
+  dof 10   d  2.98000000e+02
+  dof 14   d  6.88888889e-01
+Node           9 (       9):
+  dof 10   d  3.48000000e+02
+  dof 14   d  1.00000000e+00
+Node          10 (      10):
+  dof 10   d  3.48000000e+02
+  dof 14   d  1.00000000e+00
+Node          11 (      11):
+  dof 10   d  3.48000000e+02
+  dof 14   d  1.00000000e+00
+Node          12 (      12):
+  dof 10   d  3.48000000e+02
+  dof 14   d  1.00000000e+00
+Node          13 (      13):
+  dof 10   d  3.00000000e+02
+  dof 14   d  1.00000000e+00
+Node          14 (      14):
+  dof 10   d  3.00000000e+02
+  dof 14   d  1.00000000e+00
+Node          15 (      15):
+  dof 10   d  3.00000000e+02
+  dof 14   d  1.00000000e+00
+Node          16 (      16):
+  dof 10   d  3.00000000e+02
+  dof 14   d  1.00000000e+00
+Node          17 (      17):
+  dof 10   d  3.00000000e+02
+  dof 14   d  1.00000000e+00
+Node          18 (      18):
+  dof 10   d  3.00000000e+02
+  dof 14   d  1.00000000e+00
+Node          19 (      19):
+  dof 10   d  3.00000000e+02
+  dof 14   d  1.00000000e+00
+Node          20 (      20):
+  dof 10   d  3.00000000e+02
+  dof 14   d  1.00000000e+00
+Node          21 (      21):
+  dof 10   d  3.00000000e+02
+  dof 14   d  6.88888889e-01
+Node          22 (      22):
+  dof 10   d  3.00000000e+02
+  dof 14   d  6.88888889e-01
+Node          23 (      23):
+  dof 10   d  3.00000000e+02
+  dof 14   d  6.88888889e-01
+Node          24 (      24):
+  dof 10   d  3.00000000e+02
+  dof 14   d  6.88888889e-01
+
+
+
+
+Element output:
+---------------
+element 1 (       1) :
+  GP  1.1  :  temperature 2.9800e+02   t_flux 0.0000e+00 2.2737e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.2  :  temperature 2.9800e+02   t_flux 0.0000e+00 2.2737e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.3  :  temperature 2.9800e+02   t_flux 0.0000e+00 4.5475e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.4  :  temperature 2.9800e+02   t_flux 0.0000e+00 4.5475e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+element 2 (       2) :
+  GP  1.1  :  temperature 2.9800e+02   t_flux 0.0000e+00 -1.1369e-13 0.0000e+00  humidity 6.9444e-01   h_flux 0.0000e+00 2.8669e-22 0.0000e+00
+  GP  1.2  :  temperature 2.9800e+02   t_flux 0.0000e+00 -1.1369e-13 0.0000e+00  humidity 6.9444e-01   h_flux 0.0000e+00 2.8669e-22 0.0000e+00
+  GP  1.3  :  temperature 2.9800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 6.9444e-01   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.4  :  temperature 2.9800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 6.9444e-01   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+element 3 (       3) :
+  GP  1.1  :  temperature 3.4800e+02   t_flux 0.0000e+00 1.1369e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 -1.1102e-20 0.0000e+00
+  GP  1.2  :  temperature 3.4800e+02   t_flux 0.0000e+00 1.1369e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 -1.1102e-20 0.0000e+00
+  GP  1.3  :  temperature 3.4800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.4  :  temperature 3.4800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+element 4 (       4) :
+  GP  1.1  :  temperature 3.1500e+02   t_flux 0.0000e+00 1.1369e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.2  :  temperature 3.1500e+02   t_flux 0.0000e+00 1.1369e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.3  :  temperature 3.1500e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.4  :  temperature 3.1500e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+element 5 (       5) :
+  GP  1.1  :  temperature 3.1500e+02   t_flux 0.0000e+00 1.1369e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 -1.1102e-20 0.0000e+00
+  GP  1.2  :  temperature 3.1500e+02   t_flux 0.0000e+00 1.1369e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 -1.1102e-20 0.0000e+00
+  GP  1.3  :  temperature 3.1500e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.4  :  temperature 3.1500e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+element 6 (       6) :
+  GP  1.1  :  temperature 3.1500e+02   t_flux 0.0000e+00 -2.2737e-13 0.0000e+00  humidity 6.9444e-01   h_flux 0.0000e+00 2.8669e-22 0.0000e+00
+  GP  1.2  :  temperature 3.1500e+02   t_flux 0.0000e+00 -2.2737e-13 0.0000e+00  humidity 6.9444e-01   h_flux 0.0000e+00 2.8669e-22 0.0000e+00
+  GP  1.3  :  temperature 3.1500e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 6.9444e-01   h_flux 0.0000e+00 1.1467e-21 0.0000e+00
+  GP  1.4  :  temperature 3.1500e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 6.9444e-01   h_flux 0.0000e+00 1.1467e-21 0.0000e+00
+
+
+
+==============================================================
+Output for time 4.32000000e+07 
+==============================================================
+Output for domain   1
+
+
+DofManager output:
+------------------
+Node           1 (       1):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node           2 (       2):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node           3 (       3):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node           4 (       4):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node           5 (       5):
+  dof 10   d  2.98000000e+02
+  dof 14   d  6.55555556e-01
+Node           6 (       6):
+  dof 10   d  2.98000000e+02
+  dof 14   d  6.55555556e-01
+Node           7 (       7):
+  dof 10   d  2.98000000e+02
+  dof 14   d  6.55555556e-01
+Node           8 (       8):
+  dof 10   d  2.98000000e+02
+  dof 14   d  6.55555556e-01
+Node           9 (       9):
+  dof 10   d  3.48000000e+02
+  dof 14   d  1.00000000e+00
+Node          10 (      10):
+  dof 10   d  3.48000000e+02
+  dof 14   d  1.00000000e+00
+Node          11 (      11):
+  dof 10   d  3.48000000e+02
+  dof 14   d  1.00000000e+00
+Node          12 (      12):
+  dof 10   d  3.48000000e+02
+  dof 14   d  1.00000000e+00
+Node          13 (      13):
+  dof 10   d  2.50000000e+02
+  dof 14   d  1.00000000e+00
+Node          14 (      14):
+  dof 10   d  2.50000000e+02
+  dof 14   d  1.00000000e+00
+Node          15 (      15):
+  dof 10   d  2.50000000e+02
+  dof 14   d  1.00000000e+00
+Node          16 (      16):
+  dof 10   d  2.50000000e+02
+  dof 14   d  1.00000000e+00
+Node          17 (      17):
+  dof 10   d  2.50000000e+02
+  dof 14   d  1.00000000e+00
+Node          18 (      18):
+  dof 10   d  2.50000000e+02
+  dof 14   d  1.00000000e+00
+Node          19 (      19):
+  dof 10   d  2.50000000e+02
+  dof 14   d  1.00000000e+00
+Node          20 (      20):
+  dof 10   d  2.50000000e+02
+  dof 14   d  1.00000000e+00
+Node          21 (      21):
+  dof 10   d  2.50000000e+02
+  dof 14   d  6.55555556e-01
+Node          22 (      22):
+  dof 10   d  2.50000000e+02
+  dof 14   d  6.55555556e-01
+Node          23 (      23):
+  dof 10   d  2.50000000e+02
+  dof 14   d  6.55555556e-01
+Node          24 (      24):
+  dof 10   d  2.50000000e+02
+  dof 14   d  6.55555556e-01
+
+
+
+
+Element output:
+---------------
+element 1 (       1) :
+  GP  1.1  :  temperature 2.9800e+02   t_flux 0.0000e+00 2.2737e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.2  :  temperature 2.9800e+02   t_flux 0.0000e+00 2.2737e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.3  :  temperature 2.9800e+02   t_flux 0.0000e+00 4.5475e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.4  :  temperature 2.9800e+02   t_flux 0.0000e+00 4.5475e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+element 2 (       2) :
+  GP  1.1  :  temperature 2.9800e+02   t_flux 0.0000e+00 -1.1369e-13 0.0000e+00  humidity 6.7222e-01   h_flux 0.0000e+00 -2.8074e-22 0.0000e+00
+  GP  1.2  :  temperature 2.9800e+02   t_flux 0.0000e+00 -1.1369e-13 0.0000e+00  humidity 6.7222e-01   h_flux 0.0000e+00 -2.8074e-22 0.0000e+00
+  GP  1.3  :  temperature 2.9800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 6.7222e-01   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.4  :  temperature 2.9800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 6.7222e-01   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+element 3 (       3) :
+  GP  1.1  :  temperature 3.4800e+02   t_flux 0.0000e+00 1.1369e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 -1.1102e-20 0.0000e+00
+  GP  1.2  :  temperature 3.4800e+02   t_flux 0.0000e+00 1.1369e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 -1.1102e-20 0.0000e+00
+  GP  1.3  :  temperature 3.4800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.4  :  temperature 3.4800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+element 4 (       4) :
+  GP  1.1  :  temperature 2.7500e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.2  :  temperature 2.7500e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.3  :  temperature 2.7500e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.4  :  temperature 2.7500e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+element 5 (       5) :
+  GP  1.1  :  temperature 2.7500e+02   t_flux 0.0000e+00 1.1369e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 -1.1102e-20 0.0000e+00
+  GP  1.2  :  temperature 2.7500e+02   t_flux 0.0000e+00 1.1369e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 -1.1102e-20 0.0000e+00
+  GP  1.3  :  temperature 2.7500e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.4  :  temperature 2.7500e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+element 6 (       6) :
+  GP  1.1  :  temperature 2.7500e+02   t_flux 0.0000e+00 -1.1369e-13 0.0000e+00  humidity 6.7222e-01   h_flux 0.0000e+00 -2.8074e-22 0.0000e+00
+  GP  1.2  :  temperature 2.7500e+02   t_flux 0.0000e+00 -1.1369e-13 0.0000e+00  humidity 6.7222e-01   h_flux 0.0000e+00 -2.8074e-22 0.0000e+00
+  GP  1.3  :  temperature 2.7500e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 6.7222e-01   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.4  :  temperature 2.7500e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 6.7222e-01   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+
+
+
+==============================================================
+Output for time 8.64000000e+07 
+==============================================================
+Output for domain   1
+
+
+DofManager output:
+------------------
+Node           1 (       1):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node           2 (       2):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node           3 (       3):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node           4 (       4):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node           5 (       5):
+  dof 10   d  2.98000000e+02
+  dof 14   d  6.00000000e-01
+Node           6 (       6):
+  dof 10   d  2.98000000e+02
+  dof 14   d  6.00000000e-01
+Node           7 (       7):
+  dof 10   d  2.98000000e+02
+  dof 14   d  6.00000000e-01
+Node           8 (       8):
+  dof 10   d  2.98000000e+02
+  dof 14   d  6.00000000e-01
+Node           9 (       9):
+  dof 10   d  3.48000000e+02
+  dof 14   d  1.00000000e+00
+Node          10 (      10):
+  dof 10   d  3.48000000e+02
+  dof 14   d  1.00000000e+00
+Node          11 (      11):
+  dof 10   d  3.48000000e+02
+  dof 14   d  1.00000000e+00
+Node          12 (      12):
+  dof 10   d  3.48000000e+02
+  dof 14   d  1.00000000e+00
+Node          13 (      13):
+  dof 10   d  2.50000000e+02
+  dof 14   d  1.00000000e+00
+Node          14 (      14):
+  dof 10   d  2.50000000e+02
+  dof 14   d  1.00000000e+00
+Node          15 (      15):
+  dof 10   d  2.50000000e+02
+  dof 14   d  1.00000000e+00
+Node          16 (      16):
+  dof 10   d  2.50000000e+02
+  dof 14   d  1.00000000e+00
+Node          17 (      17):
+  dof 10   d  2.50000000e+02
+  dof 14   d  1.00000000e+00
+Node          18 (      18):
+  dof 10   d  2.50000000e+02
+  dof 14   d  1.00000000e+00
+Node          19 (      19):
+  dof 10   d  2.50000000e+02
+  dof 14   d  1.00000000e+00
+Node          20 (      20):
+  dof 10   d  2.50000000e+02
+  dof 14   d  1.00000000e+00
+Node          21 (      21):
+  dof 10   d  2.50000000e+02
+  dof 14   d  6.00000000e-01
+Node          22 (      22):
+  dof 10   d  2.50000000e+02
+  dof 14   d  6.00000000e-01
+Node          23 (      23):
+  dof 10   d  2.50000000e+02
+  dof 14   d  6.00000000e-01
+Node          24 (      24):
+  dof 10   d  2.50000000e+02
+  dof 14   d  6.00000000e-01
+
+
+
+
+Element output:
+---------------
+element 1 (       1) :
+  GP  1.1  :  temperature 2.9800e+02   t_flux 0.0000e+00 2.2737e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.2  :  temperature 2.9800e+02   t_flux 0.0000e+00 2.2737e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.3  :  temperature 2.9800e+02   t_flux 0.0000e+00 4.5475e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.4  :  temperature 2.9800e+02   t_flux 0.0000e+00 4.5475e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+element 2 (       2) :
+  GP  1.1  :  temperature 2.9800e+02   t_flux 0.0000e+00 -1.1369e-13 0.0000e+00  humidity 6.2778e-01   h_flux 0.0000e+00 2.7803e-22 0.0000e+00
+  GP  1.2  :  temperature 2.9800e+02   t_flux 0.0000e+00 -1.1369e-13 0.0000e+00  humidity 6.2778e-01   h_flux 0.0000e+00 2.7803e-22 0.0000e+00
+  GP  1.3  :  temperature 2.9800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 6.2778e-01   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.4  :  temperature 2.9800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 6.2778e-01   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+element 3 (       3) :
+  GP  1.1  :  temperature 3.4800e+02   t_flux 0.0000e+00 1.1369e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 -1.1102e-20 0.0000e+00
+  GP  1.2  :  temperature 3.4800e+02   t_flux 0.0000e+00 1.1369e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 -1.1102e-20 0.0000e+00
+  GP  1.3  :  temperature 3.4800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.4  :  temperature 3.4800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+element 4 (       4) :
+  GP  1.1  :  temperature 2.5000e+02   t_flux 0.0000e+00 -1.1369e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.2  :  temperature 2.5000e+02   t_flux 0.0000e+00 -1.1369e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.3  :  temperature 2.5000e+02   t_flux 0.0000e+00 -2.2737e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.4  :  temperature 2.5000e+02   t_flux 0.0000e+00 -2.2737e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+element 5 (       5) :
+  GP  1.1  :  temperature 2.5000e+02   t_flux 0.0000e+00 2.2737e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 -1.1102e-20 0.0000e+00
+  GP  1.2  :  temperature 2.5000e+02   t_flux 0.0000e+00 2.2737e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 -1.1102e-20 0.0000e+00
+  GP  1.3  :  temperature 2.5000e+02   t_flux 0.0000e+00 2.2737e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.4  :  temperature 2.5000e+02   t_flux 0.0000e+00 2.2737e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+element 6 (       6) :
+  GP  1.1  :  temperature 2.5000e+02   t_flux 0.0000e+00 -1.1369e-13 0.0000e+00  humidity 6.2778e-01   h_flux 0.0000e+00 2.7803e-22 0.0000e+00
+  GP  1.2  :  temperature 2.5000e+02   t_flux 0.0000e+00 -1.1369e-13 0.0000e+00  humidity 6.2778e-01   h_flux 0.0000e+00 2.7803e-22 0.0000e+00
+  GP  1.3  :  temperature 2.5000e+02   t_flux 0.0000e+00 -2.2737e-13 0.0000e+00  humidity 6.2778e-01   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.4  :  temperature 2.5000e+02   t_flux 0.0000e+00 -2.2737e-13 0.0000e+00  humidity 6.2778e-01   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+
+
+
+==============================================================
+Output for time 1.72800000e+08 
+==============================================================
+Output for domain   1
+
+
+DofManager output:
+------------------
+Node           1 (       1):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node           2 (       2):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node           3 (       3):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node           4 (       4):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node           5 (       5):
+  dof 10   d  2.98000000e+02
+  dof 14   d  5.88888889e-01
+Node           6 (       6):
+  dof 10   d  2.98000000e+02
+  dof 14   d  5.88888889e-01
+Node           7 (       7):
+  dof 10   d  2.98000000e+02
+  dof 14   d  5.88888889e-01
+Node           8 (       8):
+  dof 10   d  2.98000000e+02
+  dof 14   d  5.88888889e-01
+Node           9 (       9):
+  dof 10   d  3.48000000e+02
+  dof 14   d  1.00000000e+00
+Node          10 (      10):
+  dof 10   d  3.48000000e+02
+  dof 14   d  1.00000000e+00
+Node          11 (      11):
+  dof 10   d  3.48000000e+02
+  dof 14   d  1.00000000e+00
+Node          12 (      12):
+  dof 10   d  3.48000000e+02
+  dof 14   d  1.00000000e+00
+Node          13 (      13):
+  dof 10   d  3.30000000e+02
+  dof 14   d  1.00000000e+00
+Node          14 (      14):
+  dof 10   d  3.30000000e+02
+  dof 14   d  1.00000000e+00
+Node          15 (      15):
+  dof 10   d  3.30000000e+02
+  dof 14   d  1.00000000e+00
+Node          16 (      16):
+  dof 10   d  3.30000000e+02
+  dof 14   d  1.00000000e+00
+Node          17 (      17):
+  dof 10   d  3.30000000e+02
+  dof 14   d  1.00000000e+00
+Node          18 (      18):
+  dof 10   d  3.30000000e+02
+  dof 14   d  1.00000000e+00
+Node          19 (      19):
+  dof 10   d  3.30000000e+02
+  dof 14   d  1.00000000e+00
+Node          20 (      20):
+  dof 10   d  3.30000000e+02
+  dof 14   d  1.00000000e+00
+Node          21 (      21):
+  dof 10   d  3.30000000e+02
+  dof 14   d  5.88888889e-01
+Node          22 (      22):
+  dof 10   d  3.30000000e+02
+  dof 14   d  5.88888889e-01
+Node          23 (      23):
+  dof 10   d  3.30000000e+02
+  dof 14   d  5.88888889e-01
+Node          24 (      24):
+  dof 10   d  3.30000000e+02
+  dof 14   d  5.88888889e-01
+
+
+
+
+Element output:
+---------------
+element 1 (       1) :
+  GP  1.1  :  temperature 2.9800e+02   t_flux 0.0000e+00 2.2737e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.2  :  temperature 2.9800e+02   t_flux 0.0000e+00 2.2737e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.3  :  temperature 2.9800e+02   t_flux 0.0000e+00 4.5475e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.4  :  temperature 2.9800e+02   t_flux 0.0000e+00 4.5475e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+element 2 (       2) :
+  GP  1.1  :  temperature 2.9800e+02   t_flux 0.0000e+00 -1.1369e-13 0.0000e+00  humidity 5.9444e-01   h_flux 0.0000e+00 2.7769e-22 0.0000e+00
+  GP  1.2  :  temperature 2.9800e+02   t_flux 0.0000e+00 -1.1369e-13 0.0000e+00  humidity 5.9444e-01   h_flux 0.0000e+00 2.7769e-22 0.0000e+00
+  GP  1.3  :  temperature 2.9800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 5.9444e-01   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.4  :  temperature 2.9800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 5.9444e-01   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+element 3 (       3) :
+  GP  1.1  :  temperature 3.4800e+02   t_flux 0.0000e+00 1.1369e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 -1.1102e-20 0.0000e+00
+  GP  1.2  :  temperature 3.4800e+02   t_flux 0.0000e+00 1.1369e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 -1.1102e-20 0.0000e+00
+  GP  1.3  :  temperature 3.4800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.4  :  temperature 3.4800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+element 4 (       4) :
+  GP  1.1  :  temperature 2.9000e+02   t_flux 0.0000e+00 2.2737e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.2  :  temperature 2.9000e+02   t_flux 0.0000e+00 2.2737e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.3  :  temperature 2.9000e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.4  :  temperature 2.9000e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+element 5 (       5) :
+  GP  1.1  :  temperature 2.9000e+02   t_flux 0.0000e+00 -1.1369e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 -1.1102e-20 0.0000e+00
+  GP  1.2  :  temperature 2.9000e+02   t_flux 0.0000e+00 -1.1369e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 -1.1102e-20 0.0000e+00
+  GP  1.3  :  temperature 2.9000e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.4  :  temperature 2.9000e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+element 6 (       6) :
+  GP  1.1  :  temperature 2.9000e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 5.9444e-01   h_flux 0.0000e+00 -5.5537e-22 0.0000e+00
+  GP  1.2  :  temperature 2.9000e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 5.9444e-01   h_flux 0.0000e+00 -5.5537e-22 0.0000e+00
+  GP  1.3  :  temperature 2.9000e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 5.9444e-01   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.4  :  temperature 2.9000e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 5.9444e-01   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+
+
+
+==============================================================
+Output for time 4.32000000e+08 
+==============================================================
+Output for domain   1
+
+
+DofManager output:
+------------------
+Node           1 (       1):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node           2 (       2):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node           3 (       3):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node           4 (       4):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node           5 (       5):
+  dof 10   d  2.98000000e+02
+  dof 14   d  5.55555556e-01
+Node           6 (       6):
+  dof 10   d  2.98000000e+02
+  dof 14   d  5.55555556e-01
+Node           7 (       7):
+  dof 10   d  2.98000000e+02
+  dof 14   d  5.55555556e-01
+Node           8 (       8):
+  dof 10   d  2.98000000e+02
+  dof 14   d  5.55555556e-01
+Node           9 (       9):
+  dof 10   d  3.48000000e+02
+  dof 14   d  1.00000000e+00
+Node          10 (      10):
+  dof 10   d  3.48000000e+02
+  dof 14   d  1.00000000e+00
+Node          11 (      11):
+  dof 10   d  3.48000000e+02
+  dof 14   d  1.00000000e+00
+Node          12 (      12):
+  dof 10   d  3.48000000e+02
+  dof 14   d  1.00000000e+00
+Node          13 (      13):
+  dof 10   d  3.00000000e+02
+  dof 14   d  1.00000000e+00
+Node          14 (      14):
+  dof 10   d  3.00000000e+02
+  dof 14   d  1.00000000e+00
+Node          15 (      15):
+  dof 10   d  3.00000000e+02
+  dof 14   d  1.00000000e+00
+Node          16 (      16):
+  dof 10   d  3.00000000e+02
+  dof 14   d  1.00000000e+00
+Node          17 (      17):
+  dof 10   d  3.00000000e+02
+  dof 14   d  1.00000000e+00
+Node          18 (      18):
+  dof 10   d  3.00000000e+02
+  dof 14   d  1.00000000e+00
+Node          19 (      19):
+  dof 10   d  3.00000000e+02
+  dof 14   d  1.00000000e+00
+Node          20 (      20):
+  dof 10   d  3.00000000e+02
+  dof 14   d  1.00000000e+00
+Node          21 (      21):
+  dof 10   d  3.00000000e+02
+  dof 14   d  5.55555556e-01
+Node          22 (      22):
+  dof 10   d  3.00000000e+02
+  dof 14   d  5.55555556e-01
+Node          23 (      23):
+  dof 10   d  3.00000000e+02
+  dof 14   d  5.55555556e-01
+Node          24 (      24):
+  dof 10   d  3.00000000e+02
+  dof 14   d  5.55555556e-01
+
+
+
+
+Element output:
+---------------
+element 1 (       1) :
+  GP  1.1  :  temperature 2.9800e+02   t_flux 0.0000e+00 2.2737e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.2  :  temperature 2.9800e+02   t_flux 0.0000e+00 2.2737e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.3  :  temperature 2.9800e+02   t_flux 0.0000e+00 4.5475e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.4  :  temperature 2.9800e+02   t_flux 0.0000e+00 4.5475e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+element 2 (       2) :
+  GP  1.1  :  temperature 2.9800e+02   t_flux 0.0000e+00 -1.1369e-13 0.0000e+00  humidity 5.7222e-01   h_flux 0.0000e+00 -5.5523e-22 0.0000e+00
+  GP  1.2  :  temperature 2.9800e+02   t_flux 0.0000e+00 -1.1369e-13 0.0000e+00  humidity 5.7222e-01   h_flux 0.0000e+00 -5.5523e-22 0.0000e+00
+  GP  1.3  :  temperature 2.9800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 5.7222e-01   h_flux 0.0000e+00 -1.1105e-21 0.0000e+00
+  GP  1.4  :  temperature 2.9800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 5.7222e-01   h_flux 0.0000e+00 -1.1105e-21 0.0000e+00
+element 3 (       3) :
+  GP  1.1  :  temperature 3.4800e+02   t_flux 0.0000e+00 1.1369e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 -1.1102e-20 0.0000e+00
+  GP  1.2  :  temperature 3.4800e+02   t_flux 0.0000e+00 1.1369e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 -1.1102e-20 0.0000e+00
+  GP  1.3  :  temperature 3.4800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.4  :  temperature 3.4800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+element 4 (       4) :
+  GP  1.1  :  temperature 3.1500e+02   t_flux 0.0000e+00 1.1369e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.2  :  temperature 3.1500e+02   t_flux 0.0000e+00 1.1369e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.3  :  temperature 3.1500e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.4  :  temperature 3.1500e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+element 5 (       5) :
+  GP  1.1  :  temperature 3.1500e+02   t_flux 0.0000e+00 1.1369e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 -1.1102e-20 0.0000e+00
+  GP  1.2  :  temperature 3.1500e+02   t_flux 0.0000e+00 1.1369e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 -1.1102e-20 0.0000e+00
+  GP  1.3  :  temperature 3.1500e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.4  :  temperature 3.1500e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+element 6 (       6) :
+  GP  1.1  :  temperature 3.1500e+02   t_flux 0.0000e+00 -2.2737e-13 0.0000e+00  humidity 5.7222e-01   h_flux 0.0000e+00 -2.7761e-22 0.0000e+00
+  GP  1.2  :  temperature 3.1500e+02   t_flux 0.0000e+00 -2.2737e-13 0.0000e+00  humidity 5.7222e-01   h_flux 0.0000e+00 -2.7761e-22 0.0000e+00
+  GP  1.3  :  temperature 3.1500e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 5.7222e-01   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.4  :  temperature 3.1500e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 5.7222e-01   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+
+
+
+==============================================================
+Output for time 8.64000000e+08 
+==============================================================
+Output for domain   1
+
+
+DofManager output:
+------------------
+Node           1 (       1):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node           2 (       2):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node           3 (       3):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node           4 (       4):
+  dof 10   d  2.98000000e+02
+  dof 14   d  1.00000000e+00
+Node           5 (       5):
+  dof 10   d  2.98000000e+02
+  dof 14   d  5.00000000e-01
+Node           6 (       6):
+  dof 10   d  2.98000000e+02
+  dof 14   d  5.00000000e-01
+Node           7 (       7):
+  dof 10   d  2.98000000e+02
+  dof 14   d  5.00000000e-01
+Node           8 (       8):
+  dof 10   d  2.98000000e+02
+  dof 14   d  5.00000000e-01
+Node           9 (       9):
+  dof 10   d  3.48000000e+02
+  dof 14   d  1.00000000e+00
+Node          10 (      10):
+  dof 10   d  3.48000000e+02
+  dof 14   d  1.00000000e+00
+Node          11 (      11):
+  dof 10   d  3.48000000e+02
+  dof 14   d  1.00000000e+00
+Node          12 (      12):
+  dof 10   d  3.48000000e+02
+  dof 14   d  1.00000000e+00
+Node          13 (      13):
+  dof 10   d  3.30000000e+02
+  dof 14   d  1.00000000e+00
+Node          14 (      14):
+  dof 10   d  3.30000000e+02
+  dof 14   d  1.00000000e+00
+Node          15 (      15):
+  dof 10   d  3.30000000e+02
+  dof 14   d  1.00000000e+00
+Node          16 (      16):
+  dof 10   d  3.30000000e+02
+  dof 14   d  1.00000000e+00
+Node          17 (      17):
+  dof 10   d  3.30000000e+02
+  dof 14   d  1.00000000e+00
+Node          18 (      18):
+  dof 10   d  3.30000000e+02
+  dof 14   d  1.00000000e+00
+Node          19 (      19):
+  dof 10   d  3.30000000e+02
+  dof 14   d  1.00000000e+00
+Node          20 (      20):
+  dof 10   d  3.30000000e+02
+  dof 14   d  1.00000000e+00
+Node          21 (      21):
+  dof 10   d  3.30000000e+02
+  dof 14   d  5.00000000e-01
+Node          22 (      22):
+  dof 10   d  3.30000000e+02
+  dof 14   d  5.00000000e-01
+Node          23 (      23):
+  dof 10   d  3.30000000e+02
+  dof 14   d  5.00000000e-01
+Node          24 (      24):
+  dof 10   d  3.30000000e+02
+  dof 14   d  5.00000000e-01
+
+
+
+
+Element output:
+---------------
+element 1 (       1) :
+  GP  1.1  :  temperature 2.9800e+02   t_flux 0.0000e+00 2.2737e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.2  :  temperature 2.9800e+02   t_flux 0.0000e+00 2.2737e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.3  :  temperature 2.9800e+02   t_flux 0.0000e+00 4.5475e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.4  :  temperature 2.9800e+02   t_flux 0.0000e+00 4.5475e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+element 2 (       2) :
+  GP  1.1  :  temperature 2.9800e+02   t_flux 0.0000e+00 -1.1369e-13 0.0000e+00  humidity 5.2778e-01   h_flux 0.0000e+00 2.7757e-22 0.0000e+00
+  GP  1.2  :  temperature 2.9800e+02   t_flux 0.0000e+00 -1.1369e-13 0.0000e+00  humidity 5.2778e-01   h_flux 0.0000e+00 2.7757e-22 0.0000e+00
+  GP  1.3  :  temperature 2.9800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 5.2778e-01   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.4  :  temperature 2.9800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 5.2778e-01   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+element 3 (       3) :
+  GP  1.1  :  temperature 3.4800e+02   t_flux 0.0000e+00 1.1369e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 -1.1102e-20 0.0000e+00
+  GP  1.2  :  temperature 3.4800e+02   t_flux 0.0000e+00 1.1369e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 -1.1102e-20 0.0000e+00
+  GP  1.3  :  temperature 3.4800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.4  :  temperature 3.4800e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+element 4 (       4) :
+  GP  1.1  :  temperature 3.1500e+02   t_flux 0.0000e+00 1.1369e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.2  :  temperature 3.1500e+02   t_flux 0.0000e+00 1.1369e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.3  :  temperature 3.1500e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.4  :  temperature 3.1500e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+element 5 (       5) :
+  GP  1.1  :  temperature 3.1500e+02   t_flux 0.0000e+00 1.1369e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 -1.1102e-20 0.0000e+00
+  GP  1.2  :  temperature 3.1500e+02   t_flux 0.0000e+00 1.1369e-13 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 -1.1102e-20 0.0000e+00
+  GP  1.3  :  temperature 3.1500e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.4  :  temperature 3.1500e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 1.0000e+00   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+element 6 (       6) :
+  GP  1.1  :  temperature 3.1500e+02   t_flux 0.0000e+00 -2.2737e-13 0.0000e+00  humidity 5.2778e-01   h_flux 0.0000e+00 5.5514e-22 0.0000e+00
+  GP  1.2  :  temperature 3.1500e+02   t_flux 0.0000e+00 -2.2737e-13 0.0000e+00  humidity 5.2778e-01   h_flux 0.0000e+00 5.5514e-22 0.0000e+00
+  GP  1.3  :  temperature 3.1500e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 5.2778e-01   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+  GP  1.4  :  temperature 3.1500e+02   t_flux 0.0000e+00 0.0000e+00 0.0000e+00  humidity 5.2778e-01   h_flux 0.0000e+00 0.0000e+00 0.0000e+00
+
+
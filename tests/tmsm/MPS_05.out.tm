@@ -0,0 +1,2483 @@
+############################################################## www.oofem.org ###
+       ####    ####   ######  ######  #    #
+     #    #  #    #  #       #       ##  ##
+    #    #  #    #  #####   #####   # ## #
+   #    #  #    #  #       #       #    #
+  #    #  #    #  #       #       #    #   OOFEM ver. 2.6
+  ####    ####   #       ######  #    #    Copyright (C) 1994-2017 Borek Patzak
+################################################################################
+
+
+Starting analysis on: Sun Oct 18 13:04:00 2026
+
+tests on creep at variable temperature 
+
+==============================================================
+Output for time 1.00000000e-10 
+==============================================================
+Output for domain   1
+
+
+DofManager output:
+------------------
+Node           1 (       1):
+  dof 10   d  2.98150000e+02
+Node           2 (       2):
+  dof 10   d  2.98150000e+02
+Node           3 (       3):
+  dof 10   d  2.98150000e+02
+Node           4 (       4):
+  dof 10   d  2.98150000e+02
+Node           5 (       5):
+  dof 10   d  2.50000000e+01
+Node           6 (       6):
+  dof 10   d  2.50000000e+01
+Node           7 (       7):
+  dof 10   d  2.50000000e+01
+Node           8 (       8):
+  dof 10   d  2.50000000e+01
+Node           9 (       9):
+  dof 10   d  3.48150000e+02
+Node          10 (      10):
+  dof 10   d  3.48150000e+02
+Node          11 (      11):
+  dof 10   d  3.48150000e+02
+Node          12 (      12):
+  dof 10   d  3.48150000e+02
+Node          13 (      13):
+  dof 10   d  7.50000000e+01
+Node          14 (      14):
+  dof 10   d  7.50000000e+01
+Node          15 (      15):
+  dof 10   d  7.50000000e+01
+Node          16 (      16):
+  dof 10   d  7.50000000e+01
+Node          17 (      17):
+  dof 10   d  2.98150000e+02
+Node          18 (      18):
+  dof 10   d  2.98150000e+02
+Node          19 (      19):
+  dof 10   d  2.98150000e+02
+Node          20 (      20):
+  dof 10   d  2.98150000e+02
+Node          21 (      21):
+  dof 10   d  2.50000000e+01
+Node          22 (      22):
+  dof 10   d  2.50000000e+01
+Node          23 (      23):
+  dof 10   d  2.50000000e+01
+Node          24 (      24):
+  dof 10   d  2.50000000e+01
+
+
+
+
+Element output:
+---------------
+element 1 (       1) :
+  GP  1.1  :  state 2.9815e+02   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.2  :  state 2.9815e+02   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.3  :  state 2.9815e+02   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 2.9815e+02   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+element 2 (       2) :
+  GP  1.1  :  state 2.5000e+01   flow -0.0000e+00 1.4211e-14 -0.0000e+00
+  GP  1.2  :  state 2.5000e+01   flow -0.0000e+00 1.4211e-14 -0.0000e+00
+  GP  1.3  :  state 2.5000e+01   flow -0.0000e+00 2.8422e-14 -0.0000e+00
+  GP  1.4  :  state 2.5000e+01   flow -0.0000e+00 2.8422e-14 -0.0000e+00
+element 3 (       3) :
+  GP  1.1  :  state 3.2315e+02   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.2  :  state 3.2315e+02   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.3  :  state 3.2315e+02   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 3.2315e+02   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+element 4 (       4) :
+  GP  1.1  :  state 5.0000e+01   flow -0.0000e+00 1.4211e-14 -0.0000e+00
+  GP  1.2  :  state 5.0000e+01   flow -0.0000e+00 1.4211e-14 -0.0000e+00
+  GP  1.3  :  state 5.0000e+01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 5.0000e+01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+element 5 (       5) :
+  GP  1.1  :  state 2.9815e+02   flow -0.0000e+00 -1.1369e-13 -0.0000e+00
+  GP  1.2  :  state 2.9815e+02   flow -0.0000e+00 -1.1369e-13 -0.0000e+00
+  GP  1.3  :  state 2.9815e+02   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 2.9815e+02   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+element 6 (       6) :
+  GP  1.1  :  state 2.5000e+01   flow -0.0000e+00 -7.1054e-15 -0.0000e+00
+  GP  1.2  :  state 2.5000e+01   flow -0.0000e+00 -7.1054e-15 -0.0000e+00
+  GP  1.3  :  state 2.5000e+01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 2.5000e+01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+
+
+
+==============================================================
+Output for time 1.00000000e-04 
+==============================================================
+Output for domain   1
+
+
+DofManager output:
+------------------
+Node           1 (       1):
+  dof 10   d  2.98150000e+02
+Node           2 (       2):
+  dof 10   d  2.98150000e+02
+Node           3 (       3):
+  dof 10   d  2.98150000e+02
+Node           4 (       4):
+  dof 10   d  2.98150000e+02
+Node           5 (       5):
+  dof 10   d  2.50000000e+01
+Node           6 (       6):
+  dof 10   d  2.50000000e+01
+Node           7 (       7):
+  dof 10   d  2.50000000e+01
+Node           8 (       8):
+  dof 10   d  2.50000000e+01
+Node           9 (       9):
+  dof 10   d  3.48150000e+02
+Node          10 (      10):
+  dof 10   d  3.48150000e+02
+Node          11 (      11):
+  dof 10   d  3.48150000e+02
+Node          12 (      12):
+  dof 10   d  3.48150000e+02
+Node          13 (      13):
+  dof 10   d  7.50000000e+01
+Node          14 (      14):
+  dof 10   d  7.50000000e+01
+Node          15 (      15):
+  dof 10   d  7.50000000e+01
+Node          16 (      16):
+  dof 10   d  7.50000000e+01
+Node          17 (      17):
+  dof 10   d  2.98150000e+02
+Node          18 (      18):
+  dof 10   d  2.98150000e+02
+Node          19 (      19):
+  dof 10   d  2.98150000e+02
+Node          20 (      20):
+  dof 10   d  2.98150000e+02
+Node          21 (      21):
+  dof 10   d  2.50000000e+01
+Node          22 (      22):
+  dof 10   d  2.50000000e+01
+Node          23 (      23):
+  dof 10   d  2.50000000e+01
+Node          24 (      24):
+  dof 10   d  2.50000000e+01
+
+
+
+
+Element output:
+---------------
+element 1 (       1) :
+  GP  1.1  :  state 2.9815e+02   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.2  :  state 2.9815e+02   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.3  :  state 2.9815e+02   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 2.9815e+02   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+element 2 (       2) :
+  GP  1.1  :  state 2.5000e+01   flow -0.0000e+00 1.4211e-14 -0.0000e+00
+  GP  1.2  :  state 2.5000e+01   flow -0.0000e+00 1.4211e-14 -0.0000e+00
+  GP  1.3  :  state 2.5000e+01   flow -0.0000e+00 2.8422e-14 -0.0000e+00
+  GP  1.4  :  state 2.5000e+01   flow -0.0000e+00 2.8422e-14 -0.0000e+00
+element 3 (       3) :
+  GP  1.1  :  state 3.4815e+02   flow -0.0000e+00 1.1369e-13 -0.0000e+00
+  GP  1.2  :  state 3.4815e+02   flow -0.0000e+00 1.1369e-13 -0.0000e+00
+  GP  1.3  :  state 3.4815e+02   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 3.4815e+02   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+element 4 (       4) :
+  GP  1.1  :  state 7.5000e+01   flow -0.0000e+00 2.8422e-14 -0.0000e+00
+  GP  1.2  :  state 7.5000e+01   flow -0.0000e+00 2.8422e-14 -0.0000e+00
+  GP  1.3  :  state 7.5000e+01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 7.5000e+01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+element 5 (       5) :
+  GP  1.1  :  state 2.9815e+02   flow -0.0000e+00 -1.1369e-13 -0.0000e+00
+  GP  1.2  :  state 2.9815e+02   flow -0.0000e+00 -1.1369e-13 -0.0000e+00
+  GP  1.3  :  state 2.9815e+02   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 2.9815e+02   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+element 6 (       6) :
+  GP  1.1  :  state 2.5000e+01   flow -0.0000e+00 -7.1054e-15 -0.0000e+00
+  GP  1.2  :  state 2.5000e+01   flow -0.0000e+00 -7.1054e-15 -0.0000e+00
+  GP  1.3  :  state 2.5000e+01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 2.5000e+01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+
+
+
+==============================================================
+Output for time 2.00000000e-04 
+==============================================================
+Output for domain   1
+
+
+DofManager output:
+------------------
+Node           1 (       1):
+  dof 10   d  2.98150000e+02
+Node           2 (       2):
+  dof 10   d  2.98150000e+02
+Node           3 (       3):
+  dof 10   d  2.98150000e+02
+Node           4 (       4):
+  dof 10   d  2.98150000e+02
+Node           5 (       5):
+  dof 10   d  2.50000000e+01
+Node           6 (       6):
+  dof 10   d  2.50000000e+01
+Node           7 (       7):
+  dof 10   d  2.50000000e+01
+Node           8 (       8):
+  dof 10   d  2.50000000e+01
+Node           9 (       9):
+  dof 10   d  3.48150000e+02
+Node          10 (      10):
+  dof 10   d  3.48150000e+02
+Node          11 (      11):
+  dof 10   d  3.48150000e+02
+Node          12 (      12):
+  dof 10   d  3.48150000e+02
+Node          13 (      13):
+  dof 10   d  7.50000000e+01
+Node          14 (      14):
+  dof 10   d  7.50000000e+01
+Node          15 (      15):
+  dof 10   d  7.50000000e+01
+Node          16 (      16):
+  dof 10   d  7.50000000e+01
+Node          17 (      17):
+  dof 10   d  2.98150000e+02
+Node          18 (      18):
+  dof 10   d  2.98150000e+02
+Node          19 (      19):
+  dof 10   d  2.98150000e+02
+Node          20 (      20):
+  dof 10   d  2.98150000e+02
+Node          21 (      21):
+  dof 10   d  2.50000000e+01
+Node          22 (      22):
+  dof 10   d  2.50000000e+01
+Node          23 (      23):
+  dof 10   d  2.50000000e+01
+Node          24 (      24):
+  dof 10   d  2.50000000e+01
+
+
+
+
+Element output:
+---------------
+element 1 (       1) :
+  GP  1.1  :  state 2.9815e+02   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.2  :  state 2.9815e+02   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.3  :  state 2.9815e+02   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 2.9815e+02   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+element 2 (       2) :
+  GP  1.1  :  state 2.5000e+01   flow -0.0000e+00 1.4211e-14 -0.0000e+00
+  GP  1.2  :  state 2.5000e+01   flow -0.0000e+00 1.4211e-14 -0.0000e+00
+  GP  1.3  :  state 2.5000e+01   flow -0.0000e+00 2.8422e-14 -0.0000e+00
+  GP  1.4  :  state 2.5000e+01   flow -0.0000e+00 2.8422e-14 -0.0000e+00
+element 3 (       3) :
+  GP  1.1  :  state 3.4815e+02   flow -0.0000e+00 1.1369e-13 -0.0000e+00
+  GP  1.2  :  state 3.4815e+02   flow -0.0000e+00 1.1369e-13 -0.0000e+00
+  GP  1.3  :  state 3.4815e+02   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 3.4815e+02   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+element 4 (       4) :
+  GP  1.1  :  state 7.5000e+01   flow -0.0000e+00 2.8422e-14 -0.0000e+00
+  GP  1.2  :  state 7.5000e+01   flow -0.0000e+00 2.8422e-14 -0.0000e+00
+  GP  1.3  :  state 7.5000e+01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 7.5000e+01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+element 5 (       5) :
+  GP  1.1  :  state 2.9815e+02   flow -0.0000e+00 -1.1369e-13 -0.0000e+00
+  GP  1.2  :  state 2.9815e+02   flow -0.0000e+00 -1.1369e-13 -0.0000e+00
+  GP  1.3  :  state 2.9815e+02   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 2.9815e+02   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+element 6 (       6) :
+  GP  1.1  :  state 2.5000e+01   flow -0.0000e+00 -7.1054e-15 -0.0000e+00
+  GP  1.2  :  state 2.5000e+01   flow -0.0000e+00 -7.1054e-15 -0.0000e+00
+  GP  1.3  :  state 2.5000e+01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 2.5000e+01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+
+
+
+==============================================================
+Output for time 5.00000000e-04 
+==============================================================
+Output for domain   1
+
+
+DofManager output:
+------------------
+Node           1 (       1):
+  dof 10   d  2.98150000e+02
+Node           2 (       2):
+  dof 10   d  2.98150000e+02
+Node           3 (       3):
+  dof 10   d  2.98150000e+02
+Node           4 (       4):
+  dof 10   d  2.98150000e+02
+Node           5 (       5):
+  dof 10   d  2.50000000e+01
+Node           6 (       6):
+  dof 10   d  2.50000000e+01
+Node           7 (       7):
+  dof 10   d  2.50000000e+01
+Node           8 (       8):
+  dof 10   d  2.50000000e+01
+Node           9 (       9):
+  dof 10   d  3.48150000e+02
+Node          10 (      10):
+  dof 10   d  3.48150000e+02
+Node          11 (      11):
+  dof 10   d  3.48150000e+02
+Node          12 (      12):
+  dof 10   d  3.48150000e+02
+Node          13 (      13):
+  dof 10   d  7.50000000e+01
+Node          14 (      14):
+  dof 10   d  7.50000000e+01
+Node          15 (      15):
+  dof 10   d  7.50000000e+01
+Node          16 (      16):
+  dof 10   d  7.50000000e+01
+Node          17 (      17):
+  dof 10   d  2.98150000e+02
+Node          18 (      18):
+  dof 10   d  2.98150000e+02
+Node          19 (      19):
+  dof 10   d  2.98150000e+02
+Node          20 (      20):
+  dof 10   d  2.98150000e+02
+Node          21 (      21):
+  dof 10   d  2.50000000e+01
+Node          22 (      22):
+  dof 10   d  2.50000000e+01
+Node          23 (      23):
+  dof 10   d  2.50000000e+01
+Node          24 (      24):
+  dof 10   d  2.50000000e+01
+
+
+
+
+Element output:
+---------------
+element 1 (       1) :
+  GP  1.1  :  state 2.9815e+02   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.2  :  state 2.9815e+02   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.3  :  state 2.9815e+02   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 2.9815e+02   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+element 2 (       2) :
+  GP  1.1  :  state 2.5000e+01   flow -0.0000e+00 1.4211e-14 -0.0000e+00
+  GP  1.2  :  state 2.5000e+01   flow -0.0000e+00 1.4211e-14 -0.0000e+00
+  GP  1.3  :  state 2.5000e+01   flow -0.0000e+00 2.8422e-14 -0.0000e+00
+  GP  1.4  :  state 2.5000e+01   flow -0.0000e+00 2.8422e-14 -0.0000e+00
+element 3 (       3) :
+  GP  1.1  :  state 3.4815e+02   flow -0.0000e+00 1.1369e-13 -0.0000e+00
+  GP  1.2  :  state 3.4815e+02   flow -0.0000e+00 1.1369e-13 -0.0000e+00
+  GP  1.3  :  state 3.4815e+02   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 3.4815e+02   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+element 4 (       4) :
+  GP  1.1  :  state 7.5000e+01   flow -0.0000e+00 2.8422e-14 -0.0000e+00
+  GP  1.2  :  state 7.5000e+01   flow -0.0000e+00 2.8422e-14 -0.0000e+00
+  GP  1.3  :  state 7.5000e+01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 7.5000e+01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+element 5 (       5) :
+  GP  1.1  :  state 2.9815e+02   flow -0.0000e+00 -1.1369e-13 -0.0000e+00
+  GP  1.2  :  state 2.9815e+02   flow -0.0000e+00 -1.1369e-13 -0.0000e+00
+  GP  1.3  :  state 2.9815e+02   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 2.9815e+02   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+element 6 (       6) :
+  GP  1.1  :  state 2.5000e+01   flow -0.0000e+00 -7.1054e-15 -0.0000e+00
+  GP  1.2  :  state 2.5000e+01   flow -0.0000e+00 -7.1054e-15 -0.0000e+00
+  GP  1.3  :  state 2.5000e+01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 2.5000e+01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+
+
+
+==============================================================
+Output for time 1.00000000e-03 
+==============================================================
+Output for domain   1
+
+
+DofManager output:
+------------------
+Node           1 (       1):
+  dof 10   d  2.98150000e+02
+Node           2 (       2):
+  dof 10   d  2.98150000e+02
+Node           3 (       3):
+  dof 10   d  2.98150000e+02
+Node           4 (       4):
+  dof 10   d  2.98150000e+02
+Node           5 (       5):
+  dof 10   d  2.50000000e+01
+Node           6 (       6):
+  dof 10   d  2.50000000e+01
+Node           7 (       7):
+  dof 10   d  2.50000000e+01
+Node           8 (       8):
+  dof 10   d  2.50000000e+01
+Node           9 (       9):
+  dof 10   d  3.48150000e+02
+Node          10 (      10):
+  dof 10   d  3.48150000e+02
+Node          11 (      11):
+  dof 10   d  3.48150000e+02
+Node          12 (      12):
+  dof 10   d  3.48150000e+02
+Node          13 (      13):
+  dof 10   d  7.50000000e+01
+Node          14 (      14):
+  dof 10   d  7.50000000e+01
+Node          15 (      15):
+  dof 10   d  7.50000000e+01
+Node          16 (      16):
+  dof 10   d  7.50000000e+01
+Node          17 (      17):
+  dof 10   d  2.98150000e+02
+Node          18 (      18):
+  dof 10   d  2.98150000e+02
+Node          19 (      19):
+  dof 10   d  2.98150000e+02
+Node          20 (      20):
+  dof 10   d  2.98150000e+02
+Node          21 (      21):
+  dof 10   d  2.50000000e+01
+Node          22 (      22):
+  dof 10   d  2.50000000e+01
+Node          23 (      23):
+  dof 10   d  2.50000000e+01
+Node          24 (      24):
+  dof 10   d  2.50000000e+01
+
+
+
+
+Element output:
+---------------
+element 1 (       1) :
+  GP  1.1  :  state 2.9815e+02   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.2  :  state 2.9815e+02   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.3  :  state 2.9815e+02   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 2.9815e+02   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+element 2 (       2) :
+  GP  1.1  :  state 2.5000e+01   flow -0.0000e+00 1.4211e-14 -0.0000e+00
+  GP  1.2  :  state 2.5000e+01   flow -0.0000e+00 1.4211e-14 -0.0000e+00
+  GP  1.3  :  state 2.5000e+01   flow -0.0000e+00 2.8422e-14 -0.0000e+00
+  GP  1.4  :  state 2.5000e+01   flow -0.0000e+00 2.8422e-14 -0.0000e+00
+element 3 (       3) :
+  GP  1.1  :  state 3.4815e+02   flow -0.0000e+00 1.1369e-13 -0.0000e+00
+  GP  1.2  :  state 3.4815e+02   flow -0.0000e+00 1.1369e-13 -0.0000e+00
+  GP  1.3  :  state 3.4815e+02   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 3.4815e+02   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+element 4 (       4) :
+  GP  1.1  :  state 7.5000e+01   flow -0.0000e+00 2.8422e-14 -0.0000e+00
+  GP  1.2  :  state 7.5000e+01   flow -0.0000e+00 2.8422e-14 -0.0000e+00
+  GP  1.3  :  state 7.5000e+01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 7.5000e+01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+element 5 (       5) :
+  GP  1.1  :  state 2.9815e+02   flow -0.0000e+00 -1.1369e-13 -0.0000e+00
+  GP  1.2  :  state 2.9815e+02   flow -0.0000e+00 -1.1369e-13 -0.0000e+00
+  GP  1.3  :  state 2.9815e+02   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 2.9815e+02   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+element 6 (       6) :
+  GP  1.1  :  state 2.5000e+01   flow -0.0000e+00 -7.1054e-15 -0.0000e+00
+  GP  1.2  :  state 2.5000e+01   flow -0.0000e+00 -7.1054e-15 -0.0000e+00
+  GP  1.3  :  state 2.5000e+01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 2.5000e+01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+
+
+
+==============================================================
+Output for time 2.00000000e-03 
+==============================================================
+Output for domain   1
+
+
+DofManager output:
+------------------
+Node           1 (       1):
+  dof 10   d  2.98150000e+02
+Node           2 (       2):
+  dof 10   d  2.98150000e+02
+Node           3 (       3):
+  dof 10   d  2.98150000e+02
+Node           4 (       4):
+  dof 10   d  2.98150000e+02
+Node           5 (       5):
+  dof 10   d  2.50000000e+01
+Node           6 (       6):
+  dof 10   d  2.50000000e+01
+Node           7 (       7):
+  dof 10   d  2.50000000e+01
+Node           8 (       8):
+  dof 10   d  2.50000000e+01
+Node           9 (       9):
+  dof 10   d  3.48150000e+02
+Node          10 (      10):
+  dof 10   d  3.48150000e+02
+Node          11 (      11):
+  dof 10   d  3.48150000e+02
+Node          12 (      12):
+  dof 10   d  3.48150000e+02
+Node          13 (      13):
+  dof 10   d  7.50000000e+01
+Node          14 (      14):
+  dof 10   d  7.50000000e+01
+Node          15 (      15):
+  dof 10   d  7.50000000e+01
+Node          16 (      16):
+  dof 10   d  7.50000000e+01
+Node          17 (      17):
+  dof 10   d  2.98150000e+02
+Node          18 (      18):
+  dof 10   d  2.98150000e+02
+Node          19 (      19):
+  dof 10   d  2.98150000e+02
+Node          20 (      20):
+  dof 10   d  2.98150000e+02
+Node          21 (      21):
+  dof 10   d  2.50000000e+01
+Node          22 (      22):
+  dof 10   d  2.50000000e+01
+Node          23 (      23):
+  dof 10   d  2.50000000e+01
+Node          24 (      24):
+  dof 10   d  2.50000000e+01
+
+
+
+
+Element output:
+---------------
+element 1 (       1) :
+  GP  1.1  :  state 2.9815e+02   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.2  :  state 2.9815e+02   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.3  :  state 2.9815e+02   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 2.9815e+02   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+element 2 (       2) :
+  GP  1.1  :  state 2.5000e+01   flow -0.0000e+00 1.4211e-14 -0.0000e+00
+  GP  1.2  :  state 2.5000e+01   flow -0.0000e+00 1.4211e-14 -0.0000e+00
+  GP  1.3  :  state 2.5000e+01   flow -0.0000e+00 2.8422e-14 -0.0000e+00
+  GP  1.4  :  state 2.5000e+01   flow -0.0000e+00 2.8422e-14 -0.0000e+00
+element 3 (       3) :
+  GP  1.1  :  state 3.4815e+02   flow -0.0000e+00 1.1369e-13 -0.0000e+00
+  GP  1.2  :  state 3.4815e+02   flow -0.0000e+00 1.1369e-13 -0.0000e+00
+  GP  1.3  :  state 3.4815e+02   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 3.4815e+02   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+element 4 (       4) :
+  GP  1.1  :  state 7.5000e+01   flow -0.0000e+00 2.8422e-14 -0.0000e+00
+  GP  1.2  :  state 7.5000e+01   flow -0.0000e+00 2.8422e-14 -0.0000e+00
+  GP  1.3  :  state 7.5000e+01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 7.5000e+01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+element 5 (       5) :
+  GP  1.1  :  state 2.9815e+02   flow -0.0000e+00 -1.1369e-13 -0.0000e+00
+  GP  1.2  :  state 2.9815e+02   flow -0.0000e+00 -1.1369e-13 -0.0000e+00
+  GP  1.3  :  state 2.9815e+02   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 2.9815e+02   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+element 6 (       6) :
+  GP  1.1  :  state 2.5000e+01   flow -0.0000e+00 -7.1054e-15 -0.0000e+00
+  GP  1.2  :  state 2.5000e+01   flow -0.0000e+00 -7.1054e-15 -0.0000e+00
+  GP  1.3  :  state 2.5000e+01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 2.5000e+01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+
+
+
+==============================================================
+Output for time 5.00000000e-03 
+==============================================================
+Output for domain   1
+
+
+DofManager output:
+------------------
+Node           1 (       1):
+  dof 10   d  2.98150000e+02
+Node           2 (       2):
+  dof 10   d  2.98150000e+02
+Node           3 (       3):
+  dof 10   d  2.98150000e+02
+Node           4 (       4):
+  dof 10   d  2.98150000e+02
+Node           5 (       5):
+  dof 10   d  2.50000000e+01
+Node           6 (       6):
+  dof 10   d  2.50000000e+01
+Node           7 (       7):
+  dof 10   d  2.50000000e+01
+Node           8 (       8):
+  dof 10   d  2.50000000e+01
+Node           9 (       9):
+  dof 10   d  3.48150000e+02
+Node          10 (      10):
+  dof 10   d  3.48150000e+02
+Node          11 (      11):
+  dof 10   d  3.48150000e+02
+Node          12 (      12):
+  dof 10   d  3.48150000e+02
+Node          13 (      13):
+  dof 10   d  7.50000000e+01
+Node          14 (      14):
+  dof 10   d  7.50000000e+01
+Node          15 (      15):
+  dof 10   d  7.50000000e+01
+Node          16 (      16):
+  dof 10   d  7.50000000e+01
+Node          17 (      17):
+  dof 10   d  2.98150000e+02
+Node          18 (      18):
+  dof 10   d  2.98150000e+02
+Node          19 (      19):
+  dof 10   d  2.98150000e+02
+Node          20 (      20):
+  dof 10   d  2.98150000e+02
+Node          21 (      21):
+  dof 10   d  2.50000000e+01
+Node          22 (      22):
+  dof 10   d  2.50000000e+01
+Node          23 (      23):
+  dof 10   d  2.50000000e+01
+Node          24 (      24):
+  dof 10   d  2.50000000e+01
+
+
+
+
+Element output:
+---------------
+element 1 (       1) :
+  GP  1.1  :  state 2.9815e+02   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.2  :  state 2.9815e+02   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.3  :  state 2.9815e+02   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 2.9815e+02   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+element 2 (       2) :
+  GP  1.1  :  state 2.5000e+01   flow -0.0000e+00 1.4211e-14 -0.0000e+00
+  GP  1.2  :  state 2.5000e+01   flow -0.0000e+00 1.4211e-14 -0.0000e+00
+  GP  1.3  :  state 2.5000e+01   flow -0.0000e+00 2.8422e-14 -0.0000e+00
+  GP  1.4  :  state 2.5000e+01   flow -0.0000e+00 2.8422e-14 -0.0000e+00
+element 3 (       3) :
+  GP  1.1  :  state 3.4815e+02   flow -0.0000e+00 1.1369e-13 -0.0000e+00
+  GP  1.2  :  state 3.4815e+02   flow -0.0000e+00 1.1369e-13 -0.0000e+00
+  GP  1.3  :  state 3.4815e+02   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 3.4815e+02   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+element 4 (       4) :
+  GP  1.1  :  state 7.5000e+01   flow -0.0000e+00 2.8422e-14 -0.0000e+00
+  GP  1.2  :  state 7.5000e+01   flow -0.0000e+00 2.8422e-14 -0.0000e+00
+  GP  1.3  :  state 7.5000e+01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 7.5000e+01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+element 5 (       5) :
+  GP  1.1  :  state 2.9815e+02   flow -0.0000e+00 -1.1369e-13 -0.0000e+00
+  GP  1.2  :  state 2.9815e+02   flow -0.0000e+00 -1.1369e-13 -0.0000e+00
+  GP  1.3  :  state 2.9815e+02   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 2.9815e+02   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+element 6 (       6) :
+  GP  1.1  :  state 2.5000e+01   flow -0.0000e+00 -7.1054e-15 -0.0000e+00
+  GP  1.2  :  state 2.5000e+01   flow -0.0000e+00 -7.1054e-15 -0.0000e+00
+  GP  1.3  :  state 2.5000e+01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 2.5000e+01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+
+
+
+==============================================================
+Output for time 1.00000000e-02 
+==============================================================
+Output for domain   1
+
+
+DofManager output:
+------------------
+Node           1 (       1):
+  dof 10   d  2.98150000e+02
+Node           2 (       2):
+  dof 10   d  2.98150000e+02
+Node           3 (       3):
+  dof 10   d  2.98150000e+02
+Node           4 (       4):
+  dof 10   d  2.98150000e+02
+Node           5 (       5):
+  dof 10   d  2.50000000e+01
+Node           6 (       6):
+  dof 10   d  2.50000000e+01
+Node           7 (       7):
+  dof 10   d  2.50000000e+01
+Node           8 (       8):
+  dof 10   d  2.50000000e+01
+Node           9 (       9):
+  dof 10   d  3.48150000e+02
+Node          10 (      10):
+  dof 10   d  3.48150000e+02
+Node          11 (      11):
+  dof 10   d  3.48150000e+02
+Node          12 (      12):
+  dof 10   d  3.48150000e+02
+Node          13 (      13):
+  dof 10   d  7.50000000e+01
+Node          14 (      14):
+  dof 10   d  7.50000000e+01
+Node          15 (      15):
+  dof 10   d  7.50000000e+01
+Node          16 (      16):
+  dof 10   d  7.50000000e+01
+Node          17 (      17):
+  dof 10   d  2.98150000e+02
+Node          18 (      18):
+  dof 10   d  2.98150000e+02
+Node          19 (      19):
+  dof 10   d  2.98150000e+02
+Node          20 (      20):
+  dof 10   d  2.98150000e+02
+Node          21 (      21):
+  dof 10   d  2.50000000e+01
+Node          22 (      22):
+  dof 10   d  2.50000000e+01
+Node          23 (      23):
+  dof 10   d  2.50000000e+01
+Node          24 (      24):
+  dof 10   d  2.50000000e+01
+
+
+
+
+Element output:
+---------------
+element 1 (       1) :
+  GP  1.1  :  state 2.9815e+02   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.2  :  state 2.9815e+02   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.3  :  state 2.9815e+02   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 2.9815e+02   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+element 2 (       2) :
+  GP  1.1  :  state 2.5000e+01   flow -0.0000e+00 1.4211e-14 -0.0000e+00
+  GP  1.2  :  state 2.5000e+01   flow -0.0000e+00 1.4211e-14 -0.0000e+00
+  GP  1.3  :  state 2.5000e+01   flow -0.0000e+00 2.8422e-14 -0.0000e+00
+  GP  1.4  :  state 2.5000e+01   flow -0.0000e+00 2.8422e-14 -0.0000e+00
+element 3 (       3) :
+  GP  1.1  :  state 3.4815e+02   flow -0.0000e+00 1.1369e-13 -0.0000e+00
+  GP  1.2  :  state 3.4815e+02   flow -0.0000e+00 1.1369e-13 -0.0000e+00
+  GP  1.3  :  state 3.4815e+02   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 3.4815e+02   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+element 4 (       4) :
+  GP  1.1  :  state 7.5000e+01   flow -0.0000e+00 2.8422e-14 -0.0000e+00
+  GP  1.2  :  state 7.5000e+01   flow -0.0000e+00 2.8422e-14 -0.0000e+00
+  GP  1.3  :  state 7.5000e+01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 7.5000e+01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+element 5 (       5) :
+  GP  1.1  :  state 2.9815e+02   flow -0.0000e+00 -1.1369e-13 -0.0000e+00
+  GP  1.2  :  state 2.9815e+02   flow -0.0000e+00 -1.1369e-13 -0.0000e+00
+  GP  1.3  :  state 2.9815e+02   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 2.9815e+02   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+element 6 (       6) :
+  GP  1.1  :  state 2.5000e+01   flow -0.0000e+00 -7.1054e-15 -0.0000e+00
+  GP  1.2  :  state 2.5000e+01   flow -0.0000e+00 -7.1054e-15 -0.0000e+00
+  GP  1.3  :  state 2.5000e+01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 2.5000e+01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+
+
+
+==============================================================
+Output for time 2.00000000e-02 
+==============================================================
+Output for domain   1
+
+
+DofManager output:
+------------------
+Node           1 (       1):
+  dof 10   d  2.98150000e+02
+Node           2 (       2):
+  dof 10   d  2.98150000e+02
+Node           3 (       3):
+  dof 10   d  2.98150000e+02
+Node           4 (       4):
+  dof 10   d  2.98150000e+02
+Node           5 (       5):
+  dof 10   d  2.50000000e+01
+Node           6 (       6):
+  dof 10   d  2.50000000e+01
+Node           7 (       7):
+  dof 10   d  2.50000000e+01
+Node           8 (       8):
+  dof 10   d  2.50000000e+01
+Node           9 (       9):
+  dof 10   d  3.48150000e+02
+Node          10 (      10):
+  dof 10   d  3.48150000e+02
+Node          11 (      11):
+  dof 10   d  3.48150000e+02
+Node          12 (      12):
+  dof 10   d  3.48150000e+02
+Node          13 (      13):
+  dof 10   d  7.50000000e+01
+Node          14 (      14):
+  dof 10   d  7.50000000e+01
+Node          15 (      15):
+  dof 10   d  7.50000000e+01
+Node          16 (      16):
+  dof 10   d  7.50000000e+01
+Node          17 (      17):
+  dof 10   d  2.98150000e+02
+Node          18 (      18):
+  dof 10   d  2.98150000e+02
+Node          19 (      19):
+  dof 10   d  2.98150000e+02
+Node          20 (      20):
+  dof 10   d  2.98150000e+02
+Node          21 (      21):
+  dof 10   d  2.50000000e+01
+Node          22 (      22):
+  dof 10   d  2.50000000e+01
+Node          23 (      23):
+  dof 10   d  2.50000000e+01
+Node          24 (      24):
+  dof 10   d  2.50000000e+01
+
+
+
+
+Element output:
+---------------
+element 1 (       1) :
+  GP  1.1  :  state 2.9815e+02   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.2  :  state 2.9815e+02   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.3  :  state 2.9815e+02   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 2.9815e+02   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+element 2 (       2) :
+  GP  1.1  :  state 2.5000e+01   flow -0.0000e+00 1.4211e-14 -0.0000e+00
+  GP  1.2  :  state 2.5000e+01   flow -0.0000e+00 1.4211e-14 -0.0000e+00
+  GP  1.3  :  state 2.5000e+01   flow -0.0000e+00 2.8422e-14 -0.0000e+00
+  GP  1.4  :  state 2.5000e+01   flow -0.0000e+00 2.8422e-14 -0.0000e+00
+element 3 (       3) :
+  GP  1.1  :  state 3.4815e+02   flow -0.0000e+00 1.1369e-13 -0.0000e+00
+  GP  1.2  :  state 3.4815e+02   flow -0.0000e+00 1.1369e-13 -0.0000e+00
+  GP  1.3  :  state 3.4815e+02   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 3.4815e+02   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+element 4 (       4) :
+  GP  1.1  :  state 7.5000e+01   flow -0.0000e+00 2.8422e-14 -0.0000e+00
+  GP  1.2  :  state 7.5000e+01   flow -0.0000e+00 2.8422e-14 -0.0000e+00
+  GP  1.3  :  state 7.5000e+01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 7.5000e+01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+element 5 (       5) :
+  GP  1.1  :  state 2.9815e+02   flow -0.0000e+00 -1.1369e-13 -0.0000e+00
+  GP  1.2  :  state 2.9815e+02   flow -0.0000e+00 -1.1369e-13 -0.0000e+00
+  GP  1.3  :  state 2.9815e+02   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 2.9815e+02   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+element 6 (       6) :
+  GP  1.1  :  state 2.5000e+01   flow -0.0000e+00 -7.1054e-15 -0.0000e+00
+  GP  1.2  :  state 2.5000e+01   flow -0.0000e+00 -7.1054e-15 -0.0000e+00
+  GP  1.3  :  state 2.5000e+01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 2.5000e+01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+
+
+
+==============================================================
+Output for time 5.00000000e-02 
+==============================================================
+Output for domain   1
+
+
+DofManager output:
+------------------
+Node           1 (       1):
+  dof 10   d  2.98150000e+02
+Node           2 (       2):
+  dof 10   d  2.98150000e+02
+Node           3 (       3):
+  dof 10   d  2.98150000e+02
+Node           4 (       4):
+  dof 10   d  2.98150000e+02
+Node           5 (       5):
+  dof 10   d  2.50000000e+01
+Node           6 (       6):
+  dof 10   d  2.50000000e+01
+Node           7 (       7):
+  dof 10   d  2.50000000e+01
+Node           8 (       8):
+  dof 10   d  2.50000000e+01
+Node           9 (       9):
+  dof 10   d  3.48150000e+02
+Node          10 (      10):
+  dof 10   d  3.48150000e+02
+Node          11 (      11):
+  dof 10   d  3.48150000e+02
+Node          12 (      12):
+  dof 10   d  3.48150000e+02
+Node          13 (      13):
+  dof 10   d  7.50000000e+01
+Node          14 (      14):
+  dof 10   d  7.50000000e+01
+Node          15 (      15):
+  dof 10   d  7.50000000e+01
+Node          16 (      16):
+  dof 10   d  7.50000000e+01
+Node          17 (      17):
+  dof 10   d  2.98150000e+02
+Node          18 (      18):
+  dof 10   d  2.98150000e+02
+Node          19 (      19):
+  dof 10   d  2.98150000e+02
+Node          20 (      20):
+  dof 10   d  2.98150000e+02
+Node          21 (      21):
+  dof 10   d  2.50000000e+01
+Node          22 (      22):
+  dof 10   d  2.50000000e+01
+Node          23 (      23):
+  dof 10   d  2.50000000e+01
+Node          24 (      24):
+  dof 10   d  2.50000000e+01
+
+
+
+
+Element output:
+---------------
+element 1 (       1) :
+  GP  1.1  :  state 2.9815e+02   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.2  :  state 2.9815e+02   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.3  :  state 2.9815e+02   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 2.9815e+02   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+element 2 (       2) :
+  GP  1.1  :  state 2.5000e+01   flow -0.0000e+00 1.4211e-14 -0.0000e+00
+  GP  1.2  :  state 2.5000e+01   flow -0.0000e+00 1.4211e-14 -0.0000e+00
+  GP  1.3  :  state 2.5000e+01   flow -0.0000e+00 2.8422e-14 -0.0000e+00
+  GP  1.4  :  state 2.5000e+01   flow -0.0000e+00 2.8422e-14 -0.0000e+00
+element 3 (       3) :
+  GP  1.1  :  state 3.4815e+02   flow -0.0000e+00 1.1369e-13 -0.0000e+00
+  GP  1.2  :  state 3.4815e+02   flow -0.0000e+00 1.1369e-13 -0.0000e+00
+  GP  1.3  :  state 3.4815e+02   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 3.4815e+02   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+element 4 (       4) :
+  GP  1.1  :  state 7.5000e+01   flow -0.0000e+00 2.8422e-14 -0.0000e+00
+  GP  1.2  :  state 7.5000e+01   flow -0.0000e+00 2.8422e-14 -0.0000e+00
+  GP  1.3  :  state 7.5000e+01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 7.5000e+01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+element 5 (       5) :
+  GP  1.1  :  state 2.9815e+02   flow -0.0000e+00 -1.1369e-13 -0.0000e+00
+  GP  1.2  :  state 2.9815e+02   flow -0.0000e+00 -1.1369e-13 -0.0000e+00
+  GP  1.3  :  state 2.9815e+02   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 2.9815e+02   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+element 6 (       6) :
+  GP  1.1  :  state 2.5000e+01   flow -0.0000e+00 -7.1054e-15 -0.0000e+00
+  GP  1.2  :  state 2.5000e+01   flow -0.0000e+00 -7.1054e-15 -0.0000e+00
+  GP  1.3  :  state 2.5000e+01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 2.5000e+01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+
+
+
+==============================================================
+Output for time 1.00000000e-01 
+==============================================================
+Output for domain   1
+
+
+DofManager output:
+------------------
+Node           1 (       1):
+  dof 10   d  2.98150000e+02
+Node           2 (       2):
+  dof 10   d  2.98150000e+02
+Node           3 (       3):
+  dof 10   d  2.98150000e+02
+Node           4 (       4):
+  dof 10   d  2.98150000e+02
+Node           5 (       5):
+  dof 10   d  2.50000000e+01
+Node           6 (       6):
+  dof 10   d  2.50000000e+01
+Node           7 (       7):
+  dof 10   d  2.50000000e+01
+Node           8 (       8):
+  dof 10   d  2.50000000e+01
+Node           9 (       9):
+  dof 10   d  3.48150000e+02
+Node          10 (      10):
+  dof 10   d  3.48150000e+02
+Node          11 (      11):
+  dof 10   d  3.48150000e+02
+Node          12 (      12):
+  dof 10   d  3.48150000e+02
+Node          13 (      13):
+  dof 10   d  7.50000000e+01
+Node          14 (      14):
+  dof 10   d  7.50000000e+01
+Node          15 (      15):
+  dof 10   d  7.50000000e+01
+Node          16 (      16):
+  dof 10   d  7.50000000e+01
+Node          17 (      17):
+  dof 10   d  2.98150000e+02
+Node          18 (      18):
+  dof 10   d  2.98150000e+02
+Node          19 (      19):
+  dof 10   d  2.98150000e+02
+Node          20 (      20):
+  dof 10   d  2.98150000e+02
+Node          21 (      21):
+  dof 10   d  2.50000000e+01
+Node          22 (      22):
+  dof 10   d  2.50000000e+01
+Node          23 (      23):
+  dof 10   d  2.50000000e+01
+Node          24 (      24):
+  dof 10   d  2.50000000e+01
+
+
+
+
+Element output:
+---------------
+element 1 (       1) :
+  GP  1.1  :  state 2.9815e+02   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.2  :  state 2.9815e+02   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.3  :  state 2.9815e+02   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 2.9815e+02   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+element 2 (       2) :
+  GP  1.1  :  state 2.5000e+01   flow -0.0000e+00 1.4211e-14 -0.0000e+00
+  GP  1.2  :  state 2.5000e+01   flow -0.0000e+00 1.4211e-14 -0.0000e+00
+  GP  1.3  :  state 2.5000e+01   flow -0.0000e+00 2.8422e-14 -0.0000e+00
+  GP  1.4  :  state 2.5000e+01   flow -0.0000e+00 2.8422e-14 -0.0000e+00
+element 3 (       3) :
+  GP  1.1  :  state 3.4815e+02   flow -0.0000e+00 1.1369e-13 -0.0000e+00
+  GP  1.2  :  state 3.4815e+02   flow -0.0000e+00 1.1369e-13 -0.0000e+00
+  GP  1.3  :  state 3.4815e+02   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 3.4815e+02   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+element 4 (       4) :
+  GP  1.1  :  state 7.5000e+01   flow -0.0000e+00 2.8422e-14 -0.0000e+00
+  GP  1.2  :  state 7.5000e+01   flow -0.0000e+00 2.8422e-14 -0.0000e+00
+  GP  1.3  :  state 7.5000e+01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 7.5000e+01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+element 5 (       5) :
+  GP  1.1  :  state 2.9815e+02   flow -0.0000e+00 -1.1369e-13 -0.0000e+00
+  GP  1.2  :  state 2.9815e+02   flow -0.0000e+00 -1.1369e-13 -0.0000e+00
+  GP  1.3  :  state 2.9815e+02   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 2.9815e+02   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+element 6 (       6) :
+  GP  1.1  :  state 2.5000e+01   flow -0.0000e+00 -7.1054e-15 -0.0000e+00
+  GP  1.2  :  state 2.5000e+01   flow -0.0000e+00 -7.1054e-15 -0.0000e+00
+  GP  1.3  :  state 2.5000e+01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 2.5000e+01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+
+
+
+==============================================================
+Output for time 2.00000000e-01 
+==============================================================
+Output for domain   1
+
+
+DofManager output:
+------------------
+Node           1 (       1):
+  dof 10   d  2.98150000e+02
+Node           2 (       2):
+  dof 10   d  2.98150000e+02
+Node           3 (       3):
+  dof 10   d  2.98150000e+02
+Node           4 (       4):
+  dof 10   d  2.98150000e+02
+Node           5 (       5):
+  dof 10   d  2.50000000e+01
+Node           6 (       6):
+  dof 10   d  2.50000000e+01
+Node           7 (       7):
+  dof 10   d  2.50000000e+01
+Node           8 (       8):
+  dof 10   d  2.50000000e+01
+Node           9 (       9):
+  dof 10   d  3.48150000e+02
+Node          10 (      10):
+  dof 10   d  3.48150000e+02
+Node          11 (      11):
+  dof 10   d  3.48150000e+02
+Node          12 (      12):
+  dof 10   d  3.48150000e+02
+Node          13 (      13):
+  dof 10   d  7.50000000e+01
+Node          14 (      14):
+  dof 10   d  7.50000000e+01
+Node          15 (      15):
+  dof 10   d  7.50000000e+01
+Node          16 (      16):
+  dof 10   d  7.50000000e+01
+Node          17 (      17):
+  dof 10   d  2.98150000e+02
+Node          18 (      18):
+  dof 10   d  2.98150000e+02
+Node          19 (      19):
+  dof 10   d  2.98150000e+02
+Node          20 (      20):
+  dof 10   d  2.98150000e+02
+Node          21 (      21):
+  dof 10   d  2.50000000e+01
+Node          22 (      22):
+  dof 10   d  2.50000000e+01
+Node          23 (      23):
+  dof 10   d  2.50000000e+01
+Node          24 (      24):
+  dof 10   d  2.50000000e+01
+
+
+
+
+Element output:
+---------------
+element 1 (       1) :
+  GP  1.1  :  state 2.9815e+02   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.2  :  state 2.9815e+02   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.3  :  state 2.9815e+02   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 2.9815e+02   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+element 2 (       2) :
+  GP  1.1  :  state 2.5000e+01   flow -0.0000e+00 1.4211e-14 -0.0000e+00
+  GP  1.2  :  state 2.5000e+01   flow -0.0000e+00 1.4211e-14 -0.0000e+00
+  GP  1.3  :  state 2.5000e+01   flow -0.0000e+00 2.8422e-14 -0.0000e+00
+  GP  1.4  :  state 2.5000e+01   flow -0.0000e+00 2.8422e-14 -0.0000e+00
+element 3 (       3) :
+  GP  1.1  :  state 3.4815e+02   flow -0.0000e+00 1.1369e-13 -0.0000e+00
+  GP  1.2  :  state 3.4815e+02   flow -0.0000e+00 1.1369e-13 -0.0000e+00
+  GP  1.3  :  state 3.4815e+02   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 3.4815e+02   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+element 4 (       4) :
+  GP  1.1  :  state 7.5000e+01   flow -0.0000e+00 2.8422e-14 -0.0000e+00
+  GP  1.2  :  state 7.5000e+01   flow -0.0000e+00 2.8422e-14 -0.0000e+00
+  GP  1.3  :  state 7.5000e+01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 7.5000e+01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+element 5 (       5) :
+  GP  1.1  :  state 2.9815e+02   flow -0.0000e+00 -1.1369e-13 -0.0000e+00
+  GP  1.2  :  state 2.9815e+02   flow -0.0000e+00 -1.1369e-13 -0.0000e+00
+  GP  1.3  :  state 2.9815e+02   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 2.9815e+02   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+element 6 (       6) :
+  GP  1.1  :  state 2.5000e+01   flow -0.0000e+00 -7.1054e-15 -0.0000e+00
+  GP  1.2  :  state 2.5000e+01   flow -0.0000e+00 -7.1054e-15 -0.0000e+00
+  GP  1.3  :  state 2.5000e+01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 2.5000e+01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+
+
+
+==============================================================
+Output for time 5.00000000e-01 
+==============================================================
+Output for domain   1
+
+
+DofManager output:
+------------------
+Node           1 (       1):
+  dof 10   d  2.98150000e+02
+Node           2 (       2):
+  dof 10   d  2.98150000e+02
+Node           3 (       3):
+  dof 10   d  2.98150000e+02
+Node           4 (       4):
+  dof 10   d  2.98150000e+02
+Node           5 (       5):
+  dof 10   d  2.50000000e+01
+Node           6 (       6):
+  dof 10   d  2.50000000e+01
+Node           7 (       7):
+  dof 10   d  2.50000000e+01
+Node           8 (       8):
+  dof 10   d  2.50000000e+01
+Node           9 (       9):
+  dof 10   d  3.48150000e+02
+Node          10 (      10):
+  dof 10   d  3.48150000e+02
+Node          11 (      11):
+  dof 10   d  3.48150000e+02
+Node          12 (      12):
+  dof 10   d  3.48150000e+02
+Node          13 (      13):
+  dof 10   d  7.50000000e+01
+Node          14 (      14):
+  dof 10   d  7.50000000e+01
+Node          15 (      15):
+  dof 10   d  7.50000000e+01
+Node          16 (      16):
+  dof 10   d  7.50000000e+01
+Node          17 (      17):
+  dof 10   d  2.98150000e+02
+Node          18 (      18):
+  dof 10   d  2.98150000e+02
+Node          19 (      19):
+  dof 10   d  2.98150000e+02
+Node          20 (      20):
+  dof 10   d  2.98150000e+02
+Node          21 (      21):
+  dof 10   d  2.50000000e+01
+Node          22 (      22):
+  dof 10   d  2.50000000e+01
+Node          23 (      23):
+  dof 10   d  2.50000000e+01
+Node          24 (      24):
+  dof 10   d  2.50000000e+01
+
+
+
+
+Element output:
+---------------
+element 1 (       1) :
+  GP  1.1  :  state 2.9815e+02   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.2  :  state 2.9815e+02   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.3  :  state 2.9815e+02   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 2.9815e+02   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+element 2 (       2) :
+  GP  1.1  :  state 2.5000e+01   flow -0.0000e+00 1.4211e-14 -0.0000e+00
+  GP  1.2  :  state 2.5000e+01   flow -0.0000e+00 1.4211e-14 -0.0000e+00
+  GP  1.3  :  state 2.5000e+01   flow -0.0000e+00 2.8422e-14 -0.0000e+00
+  GP  1.4  :  state 2.5000e+01   flow -0.0000e+00 2.8422e-14 -0.0000e+00
+element 3 (       3) :
+  GP  1.1  :  state 3.4815e+02   flow -0.0000e+00 1.1369e-13 -0.0000e+00
+  GP  1.2  :  state 3.4815e+02   flow -0.0000e+00 1.1369e-13 -0.0000e+00
+  GP  1.3  :  state 3.4815e+02   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 3.4815e+02   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+element 4 (       4) :
+  GP  1.1  :  state 7.5000e+01   flow -0.0000e+00 2.8422e-14 -0.0000e+00
+  GP  1.2  :  state 7.5000e+01   flow -0.0000e+00 2.8422e-14 -0.0000e+00
+  GP  1.3  :  state 7.5000e+01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 7.5000e+01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+element 5 (       5) :
+  GP  1.1  :  state 2.9815e+02   flow -0.0000e+00 -1.1369e-13 -0.0000e+00
+  GP  1.2  :  state 2.9815e+02   flow -0.0000e+00 -1.1369e-13 -0.0000e+00
+  GP  1.3  :  state 2.9815e+02   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 2.9815e+02   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+element 6 (       6) :
+  GP  1.1  :  state 2.5000e+01   flow -0.0000e+00 -7.1054e-15 -0.0000e+00
+  GP  1.2  :  state 2.5000e+01   flow -0.0000e+00 -7.1054e-15 -0.0000e+00
+  GP  1.3  :  state 2.5000e+01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 2.5000e+01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+
+
+
+==============================================================
+Output for time 1.00000000e+00 
+==============================================================
+Output for domain   1
+
+
+DofManager output:
+------------------
+Node           1 (       1):
+  dof 10   d  2.98150000e+02
+Node           2 (       2):
+  dof 10   d  2.98150000e+02
+Node           3 (       3):
+  dof 10   d  2.98150000e+02
+Node           4 (       4):
+  dof 10   d  2.98150000e+02
+Node           5 (       5):
+  dof 10   d  2.50000000e+01
+Node           6 (       6):
+  dof 10   d  2.50000000e+01
+Node           7 (       7):
+  dof 10   d  2.50000000e+01
+Node           8 (       8):
+  dof 10   d  2.50000000e+01
+Node           9 (       9):
+  dof 10   d  3.48150000e+02
+Node          10 (      10):
+  dof 10   d  3.48150000e+02
+Node          11 (      11):
+  dof 10   d  3.48150000e+02
+Node          12 (      12):
+  dof 10   d  3.48150000e+02
+Node          13 (      13):
+  dof 10   d  7.50000000e+01
+Node          14 (      14):
+  dof 10   d  7.50000000e+01
+Node          15 (      15):
+  dof 10   d  7.50000000e+01
+Node          16 (      16):
+  dof 10   d  7.50000000e+01
+Node          17 (      17):
+  dof 10   d  2.98150000e+02
+Node          18 (      18):
+  dof 10   d  2.98150000e+02
+Node          19 (      19):
+  dof 10   d  2.98150000e+02
+Node          20 (      20):
+  dof 10   d  2.98150000e+02
+Node          21 (      21):
+  dof 10   d  2.50000000e+01
+Node          22 (      22):
+  dof 10   d  2.50000000e+01
+Node          23 (      23):
+  dof 10   d  2.50000000e+01
+Node          24 (      24):
+  dof 10   d  2.50000000e+01
+
+
+
+
+Element output:
+---------------
+element 1 (       1) :
+  GP  1.1  :  state 2.9815e+02   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.2  :  state 2.9815e+02   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.3  :  state 2.9815e+02   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 2.9815e+02   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+element 2 (       2) :
+  GP  1.1  :  state 2.5000e+01   flow -0.0000e+00 1.4211e-14 -0.0000e+00
+  GP  1.2  :  state 2.5000e+01   flow -0.0000e+00 1.4211e-14 -0.0000e+00
+  GP  1.3  :  state 2.5000e+01   flow -0.0000e+00 2.8422e-14 -0.0000e+00
+  GP  1.4  :  state 2.5000e+01   flow -0.0000e+00 2.8422e-14 -0.0000e+00
+element 3 (       3) :
+  GP  1.1  :  state 3.4815e+02   flow -0.0000e+00 1.1369e-13 -0.0000e+00
+  GP  1.2  :  state 3.4815e+02   flow -0.0000e+00 1.1369e-13 -0.0000e+00
+  GP  1.3  :  state 3.4815e+02   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 3.4815e+02   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+element 4 (       4) :
+  GP  1.1  :  state 7.5000e+01   flow -0.0000e+00 2.8422e-14 -0.0000e+00
+  GP  1.2  :  state 7.5000e+01   flow -0.0000e+00 2.8422e-14 -0.0000e+00
+  GP  1.3  :  state 7.5000e+01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 7.5000e+01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+element 5 (       5) :
+  GP  1.1  :  state 2.9815e+02   flow -0.0000e+00 -1.1369e-13 -0.0000e+00
+  GP  1.2  :  state 2.9815e+02   flow -0.0000e+00 -1.1369e-13 -0.0000e+00
+  GP  1.3  :  state 2.9815e+02   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 2.9815e+02   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+element 6 (       6) :
+  GP  1.1  :  state 2.5000e+01   flow -0.0000e+00 -7.1054e-15 -0.0000e+00
+  GP  1.2  :  state 2.5000e+01   flow -0.0000e+00 -7.1054e-15 -0.0000e+00
+  GP  1.3  :  state 2.5000e+01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 2.5000e+01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+
+
+
+==============================================================
+Output for time 2.00000000e+00 
+==============================================================
+Output for domain   1
+
+
+DofManager output:
+------------------
+Node           1 (       1):
+  dof 10   d  2.98372222e+02
+Node           2 (       2):
+  dof 10   d  2.98372222e+02
+Node           3 (       3):
+  dof 10   d  2.98372222e+02
+Node           4 (       4):
+  dof 10   d  2.98372222e+02
+Node           5 (       5):
+  dof 10   d  2.52222222e+01
+Node           6 (       6):
+  dof 10   d  2.52222222e+01
+Node           7 (       7):
+  dof 10   d  2.52222222e+01
+Node           8 (       8):
+  dof 10   d  2.52222222e+01
+Node           9 (       9):
+  dof 10   d  3.48150000e+02
+Node          10 (      10):
+  dof 10   d  3.48150000e+02
+Node          11 (      11):
+  dof 10   d  3.48150000e+02
+Node          12 (      12):
+  dof 10   d  3.48150000e+02
+Node          13 (      13):
+  dof 10   d  7.50000000e+01
+Node          14 (      14):
+  dof 10   d  7.50000000e+01
+Node          15 (      15):
+  dof 10   d  7.50000000e+01
+Node          16 (      16):
+  dof 10   d  7.50000000e+01
+Node          17 (      17):
+  dof 10   d  2.98372222e+02
+Node          18 (      18):
+  dof 10   d  2.98372222e+02
+Node          19 (      19):
+  dof 10   d  2.98372222e+02
+Node          20 (      20):
+  dof 10   d  2.98372222e+02
+Node          21 (      21):
+  dof 10   d  2.52222222e+01
+Node          22 (      22):
+  dof 10   d  2.52222222e+01
+Node          23 (      23):
+  dof 10   d  2.52222222e+01
+Node          24 (      24):
+  dof 10   d  2.52222222e+01
+
+
+
+
+Element output:
+---------------
+element 1 (       1) :
+  GP  1.1  :  state 2.9826e+02   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.2  :  state 2.9826e+02   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.3  :  state 2.9826e+02   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 2.9826e+02   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+element 2 (       2) :
+  GP  1.1  :  state 2.5111e+01   flow -0.0000e+00 1.4211e-14 -0.0000e+00
+  GP  1.2  :  state 2.5111e+01   flow -0.0000e+00 1.4211e-14 -0.0000e+00
+  GP  1.3  :  state 2.5111e+01   flow -0.0000e+00 2.8422e-14 -0.0000e+00
+  GP  1.4  :  state 2.5111e+01   flow -0.0000e+00 2.8422e-14 -0.0000e+00
+element 3 (       3) :
+  GP  1.1  :  state 3.4815e+02   flow -0.0000e+00 1.1369e-13 -0.0000e+00
+  GP  1.2  :  state 3.4815e+02   flow -0.0000e+00 1.1369e-13 -0.0000e+00
+  GP  1.3  :  state 3.4815e+02   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 3.4815e+02   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+element 4 (       4) :
+  GP  1.1  :  state 7.5000e+01   flow -0.0000e+00 2.8422e-14 -0.0000e+00
+  GP  1.2  :  state 7.5000e+01   flow -0.0000e+00 2.8422e-14 -0.0000e+00
+  GP  1.3  :  state 7.5000e+01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 7.5000e+01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+element 5 (       5) :
+  GP  1.1  :  state 2.9826e+02   flow -0.0000e+00 -1.1369e-13 -0.0000e+00
+  GP  1.2  :  state 2.9826e+02   flow -0.0000e+00 -1.1369e-13 -0.0000e+00
+  GP  1.3  :  state 2.9826e+02   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 2.9826e+02   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+element 6 (       6) :
+  GP  1.1  :  state 2.5111e+01   flow -0.0000e+00 -7.1054e-15 -0.0000e+00
+  GP  1.2  :  state 2.5111e+01   flow -0.0000e+00 -7.1054e-15 -0.0000e+00
+  GP  1.3  :  state 2.5111e+01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 2.5111e+01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+
+
+
+==============================================================
+Output for time 5.00000000e+00 
+==============================================================
+Output for domain   1
+
+
+DofManager output:
+------------------
+Node           1 (       1):
+  dof 10   d  2.99038889e+02
+Node           2 (       2):
+  dof 10   d  2.99038889e+02
+Node           3 (       3):
+  dof 10   d  2.99038889e+02
+Node           4 (       4):
+  dof 10   d  2.99038889e+02
+Node           5 (       5):
+  dof 10   d  2.58888889e+01
+Node           6 (       6):
+  dof 10   d  2.58888889e+01
+Node           7 (       7):
+  dof 10   d  2.58888889e+01
+Node           8 (       8):
+  dof 10   d  2.58888889e+01
+Node           9 (       9):
+  dof 10   d  3.48150000e+02
+Node          10 (      10):
+  dof 10   d  3.48150000e+02
+Node          11 (      11):
+  dof 10   d  3.48150000e+02
+Node          12 (      12):
+  dof 10   d  3.48150000e+02
+Node          13 (      13):
+  dof 10   d  7.50000000e+01
+Node          14 (      14):
+  dof 10   d  7.50000000e+01
+Node          15 (      15):
+  dof 10   d  7.50000000e+01
+Node          16 (      16):
+  dof 10   d  7.50000000e+01
+Node          17 (      17):
+  dof 10   d  2.99038889e+02
+Node          18 (      18):
+  dof 10   d  2.99038889e+02
+Node          19 (      19):
+  dof 10   d  2.99038889e+02
+Node          20 (      20):
+  dof 10   d  2.99038889e+02
+Node          21 (      21):
+  dof 10   d  2.58888889e+01
+Node          22 (      22):
+  dof 10   d  2.58888889e+01
+Node          23 (      23):
+  dof 10   d  2.58888889e+01
+Node          24 (      24):
+  dof 10   d  2.58888889e+01
+
+
+
+
+Element output:
+---------------
+element 1 (       1) :
+  GP  1.1  :  state 2.9871e+02   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.2  :  state 2.9871e+02   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.3  :  state 2.9871e+02   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 2.9871e+02   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+element 2 (       2) :
+  GP  1.1  :  state 2.5556e+01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.2  :  state 2.5556e+01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.3  :  state 2.5556e+01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 2.5556e+01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+element 3 (       3) :
+  GP  1.1  :  state 3.4815e+02   flow -0.0000e+00 1.1369e-13 -0.0000e+00
+  GP  1.2  :  state 3.4815e+02   flow -0.0000e+00 1.1369e-13 -0.0000e+00
+  GP  1.3  :  state 3.4815e+02   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 3.4815e+02   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+element 4 (       4) :
+  GP  1.1  :  state 7.5000e+01   flow -0.0000e+00 2.8422e-14 -0.0000e+00
+  GP  1.2  :  state 7.5000e+01   flow -0.0000e+00 2.8422e-14 -0.0000e+00
+  GP  1.3  :  state 7.5000e+01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 7.5000e+01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+element 5 (       5) :
+  GP  1.1  :  state 2.9871e+02   flow -0.0000e+00 -1.1369e-13 -0.0000e+00
+  GP  1.2  :  state 2.9871e+02   flow -0.0000e+00 -1.1369e-13 -0.0000e+00
+  GP  1.3  :  state 2.9871e+02   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 2.9871e+02   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+element 6 (       6) :
+  GP  1.1  :  state 2.5556e+01   flow -0.0000e+00 -1.4211e-14 -0.0000e+00
+  GP  1.2  :  state 2.5556e+01   flow -0.0000e+00 -1.4211e-14 -0.0000e+00
+  GP  1.3  :  state 2.5556e+01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 2.5556e+01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+
+
+
+==============================================================
+Output for time 1.00000000e+01 
+==============================================================
+Output for domain   1
+
+
+DofManager output:
+------------------
+Node           1 (       1):
+  dof 10   d  3.00150000e+02
+Node           2 (       2):
+  dof 10   d  3.00150000e+02
+Node           3 (       3):
+  dof 10   d  3.00150000e+02
+Node           4 (       4):
+  dof 10   d  3.00150000e+02
+Node           5 (       5):
+  dof 10   d  2.70000000e+01
+Node           6 (       6):
+  dof 10   d  2.70000000e+01
+Node           7 (       7):
+  dof 10   d  2.70000000e+01
+Node           8 (       8):
+  dof 10   d  2.70000000e+01
+Node           9 (       9):
+  dof 10   d  3.48150000e+02
+Node          10 (      10):
+  dof 10   d  3.48150000e+02
+Node          11 (      11):
+  dof 10   d  3.48150000e+02
+Node          12 (      12):
+  dof 10   d  3.48150000e+02
+Node          13 (      13):
+  dof 10   d  7.50000000e+01
+Node          14 (      14):
+  dof 10   d  7.50000000e+01
+Node          15 (      15):
+  dof 10   d  7.50000000e+01
+Node          16 (      16):
+  dof 10   d  7.50000000e+01
+Node          17 (      17):
+  dof 10   d  3.00150000e+02
+Node          18 (      18):
+  dof 10   d  3.00150000e+02
+Node          19 (      19):
+  dof 10   d  3.00150000e+02
+Node          20 (      20):
+  dof 10   d  3.00150000e+02
+Node          21 (      21):
+  dof 10   d  2.70000000e+01
+Node          22 (      22):
+  dof 10   d  2.70000000e+01
+Node          23 (      23):
+  dof 10   d  2.70000000e+01
+Node          24 (      24):
+  dof 10   d  2.70000000e+01
+
+
+
+
+Element output:
+---------------
+element 1 (       1) :
+  GP  1.1  :  state 2.9959e+02   flow -0.0000e+00 -1.1369e-13 -0.0000e+00
+  GP  1.2  :  state 2.9959e+02   flow -0.0000e+00 -1.1369e-13 -0.0000e+00
+  GP  1.3  :  state 2.9959e+02   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 2.9959e+02   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+element 2 (       2) :
+  GP  1.1  :  state 2.6444e+01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.2  :  state 2.6444e+01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.3  :  state 2.6444e+01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 2.6444e+01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+element 3 (       3) :
+  GP  1.1  :  state 3.4815e+02   flow -0.0000e+00 1.1369e-13 -0.0000e+00
+  GP  1.2  :  state 3.4815e+02   flow -0.0000e+00 1.1369e-13 -0.0000e+00
+  GP  1.3  :  state 3.4815e+02   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 3.4815e+02   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+element 4 (       4) :
+  GP  1.1  :  state 7.5000e+01   flow -0.0000e+00 2.8422e-14 -0.0000e+00
+  GP  1.2  :  state 7.5000e+01   flow -0.0000e+00 2.8422e-14 -0.0000e+00
+  GP  1.3  :  state 7.5000e+01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 7.5000e+01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+element 5 (       5) :
+  GP  1.1  :  state 2.9959e+02   flow -0.0000e+00 -2.2737e-13 -0.0000e+00
+  GP  1.2  :  state 2.9959e+02   flow -0.0000e+00 -2.2737e-13 -0.0000e+00
+  GP  1.3  :  state 2.9959e+02   flow -0.0000e+00 -4.5475e-13 -0.0000e+00
+  GP  1.4  :  state 2.9959e+02   flow -0.0000e+00 -4.5475e-13 -0.0000e+00
+element 6 (       6) :
+  GP  1.1  :  state 2.6444e+01   flow -0.0000e+00 1.4211e-14 -0.0000e+00
+  GP  1.2  :  state 2.6444e+01   flow -0.0000e+00 1.4211e-14 -0.0000e+00
+  GP  1.3  :  state 2.6444e+01   flow -0.0000e+00 2.8422e-14 -0.0000e+00
+  GP  1.4  :  state 2.6444e+01   flow -0.0000e+00 2.8422e-14 -0.0000e+00
+
+
+
+==============================================================
+Output for time 2.00000000e+01 
+==============================================================
+Output for domain   1
+
+
+DofManager output:
+------------------
+Node           1 (       1):
+  dof 10   d  3.03483333e+02
+Node           2 (       2):
+  dof 10   d  3.03483333e+02
+Node           3 (       3):
+  dof 10   d  3.03483333e+02
+Node           4 (       4):
+  dof 10   d  3.03483333e+02
+Node           5 (       5):
+  dof 10   d  3.03333333e+01
+Node           6 (       6):
+  dof 10   d  3.03333333e+01
+Node           7 (       7):
+  dof 10   d  3.03333333e+01
+Node           8 (       8):
+  dof 10   d  3.03333333e+01
+Node           9 (       9):
+  dof 10   d  3.48150000e+02
+Node          10 (      10):
+  dof 10   d  3.48150000e+02
+Node          11 (      11):
+  dof 10   d  3.48150000e+02
+Node          12 (      12):
+  dof 10   d  3.48150000e+02
+Node          13 (      13):
+  dof 10   d  7.50000000e+01
+Node          14 (      14):
+  dof 10   d  7.50000000e+01
+Node          15 (      15):
+  dof 10   d  7.50000000e+01
+Node          16 (      16):
+  dof 10   d  7.50000000e+01
+Node          17 (      17):
+  dof 10   d  3.03483333e+02
+Node          18 (      18):
+  dof 10   d  3.03483333e+02
+Node          19 (      19):
+  dof 10   d  3.03483333e+02
+Node          20 (      20):
+  dof 10   d  3.03483333e+02
+Node          21 (      21):
+  dof 10   d  3.03333333e+01
+Node          22 (      22):
+  dof 10   d  3.03333333e+01
+Node          23 (      23):
+  dof 10   d  3.03333333e+01
+Node          24 (      24):
+  dof 10   d  3.03333333e+01
+
+
+
+
+Element output:
+---------------
+element 1 (       1) :
+  GP  1.1  :  state 3.0182e+02   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.2  :  state 3.0182e+02   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.3  :  state 3.0182e+02   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 3.0182e+02   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+element 2 (       2) :
+  GP  1.1  :  state 2.8667e+01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.2  :  state 2.8667e+01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.3  :  state 2.8667e+01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 2.8667e+01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+element 3 (       3) :
+  GP  1.1  :  state 3.4815e+02   flow -0.0000e+00 1.1369e-13 -0.0000e+00
+  GP  1.2  :  state 3.4815e+02   flow -0.0000e+00 1.1369e-13 -0.0000e+00
+  GP  1.3  :  state 3.4815e+02   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 3.4815e+02   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+element 4 (       4) :
+  GP  1.1  :  state 7.5000e+01   flow -0.0000e+00 2.8422e-14 -0.0000e+00
+  GP  1.2  :  state 7.5000e+01   flow -0.0000e+00 2.8422e-14 -0.0000e+00
+  GP  1.3  :  state 7.5000e+01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 7.5000e+01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+element 5 (       5) :
+  GP  1.1  :  state 3.0182e+02   flow -0.0000e+00 -1.1369e-13 -0.0000e+00
+  GP  1.2  :  state 3.0182e+02   flow -0.0000e+00 -1.1369e-13 -0.0000e+00
+  GP  1.3  :  state 3.0182e+02   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 3.0182e+02   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+element 6 (       6) :
+  GP  1.1  :  state 2.8667e+01   flow -0.0000e+00 -7.1054e-15 -0.0000e+00
+  GP  1.2  :  state 2.8667e+01   flow -0.0000e+00 -7.1054e-15 -0.0000e+00
+  GP  1.3  :  state 2.8667e+01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 2.8667e+01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+
+
+
+==============================================================
+Output for time 5.00000000e+01 
+==============================================================
+Output for domain   1
+
+
+DofManager output:
+------------------
+Node           1 (       1):
+  dof 10   d  3.13483333e+02
+Node           2 (       2):
+  dof 10   d  3.13483333e+02
+Node           3 (       3):
+  dof 10   d  3.13483333e+02
+Node           4 (       4):
+  dof 10   d  3.13483333e+02
+Node           5 (       5):
+  dof 10   d  4.03333333e+01
+Node           6 (       6):
+  dof 10   d  4.03333333e+01
+Node           7 (       7):
+  dof 10   d  4.03333333e+01
+Node           8 (       8):
+  dof 10   d  4.03333333e+01
+Node           9 (       9):
+  dof 10   d  3.48150000e+02
+Node          10 (      10):
+  dof 10   d  3.48150000e+02
+Node          11 (      11):
+  dof 10   d  3.48150000e+02
+Node          12 (      12):
+  dof 10   d  3.48150000e+02
+Node          13 (      13):
+  dof 10   d  7.50000000e+01
+Node          14 (      14):
+  dof 10   d  7.50000000e+01
+Node          15 (      15):
+  dof 10   d  7.50000000e+01
+Node          16 (      16):
+  dof 10   d  7.50000000e+01
+Node          17 (      17):
+  dof 10   d  3.13483333e+02
+Node          18 (      18):
+  dof 10   d  3.13483333e+02
+Node          19 (      19):
+  dof 10   d  3.13483333e+02
+Node          20 (      20):
+  dof 10   d  3.13483333e+02
+Node          21 (      21):
+  dof 10   d  4.03333333e+01
+Node          22 (      22):
+  dof 10   d  4.03333333e+01
+Node          23 (      23):
+  dof 10   d  4.03333333e+01
+Node          24 (      24):
+  dof 10   d  4.03333333e+01
+
+
+
+
+Element output:
+---------------
+element 1 (       1) :
+  GP  1.1  :  state 3.0848e+02   flow -0.0000e+00 -1.1369e-13 -0.0000e+00
+  GP  1.2  :  state 3.0848e+02   flow -0.0000e+00 -1.1369e-13 -0.0000e+00
+  GP  1.3  :  state 3.0848e+02   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 3.0848e+02   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+element 2 (       2) :
+  GP  1.1  :  state 3.5333e+01   flow -0.0000e+00 -2.8422e-14 -0.0000e+00
+  GP  1.2  :  state 3.5333e+01   flow -0.0000e+00 -2.8422e-14 -0.0000e+00
+  GP  1.3  :  state 3.5333e+01   flow -0.0000e+00 -5.6843e-14 -0.0000e+00
+  GP  1.4  :  state 3.5333e+01   flow -0.0000e+00 -5.6843e-14 -0.0000e+00
+element 3 (       3) :
+  GP  1.1  :  state 3.4815e+02   flow -0.0000e+00 1.1369e-13 -0.0000e+00
+  GP  1.2  :  state 3.4815e+02   flow -0.0000e+00 1.1369e-13 -0.0000e+00
+  GP  1.3  :  state 3.4815e+02   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 3.4815e+02   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+element 4 (       4) :
+  GP  1.1  :  state 7.5000e+01   flow -0.0000e+00 2.8422e-14 -0.0000e+00
+  GP  1.2  :  state 7.5000e+01   flow -0.0000e+00 2.8422e-14 -0.0000e+00
+  GP  1.3  :  state 7.5000e+01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 7.5000e+01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+element 5 (       5) :
+  GP  1.1  :  state 3.0848e+02   flow -0.0000e+00 -2.2737e-13 -0.0000e+00
+  GP  1.2  :  state 3.0848e+02   flow -0.0000e+00 -2.2737e-13 -0.0000e+00
+  GP  1.3  :  state 3.0848e+02   flow -0.0000e+00 -4.5475e-13 -0.0000e+00
+  GP  1.4  :  state 3.0848e+02   flow -0.0000e+00 -4.5475e-13 -0.0000e+00
+element 6 (       6) :
+  GP  1.1  :  state 3.5333e+01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.2  :  state 3.5333e+01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.3  :  state 3.5333e+01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 3.5333e+01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+
+
+
+==============================================================
+Output for time 1.00000000e+02 
+==============================================================
+Output for domain   1
+
+
+DofManager output:
+------------------
+Node           1 (       1):
+  dof 10   d  3.30150000e+02
+Node           2 (       2):
+  dof 10   d  3.30150000e+02
+Node           3 (       3):
+  dof 10   d  3.30150000e+02
+Node           4 (       4):
+  dof 10   d  3.30150000e+02
+Node           5 (       5):
+  dof 10   d  5.70000000e+01
+Node           6 (       6):
+  dof 10   d  5.70000000e+01
+Node           7 (       7):
+  dof 10   d  5.70000000e+01
+Node           8 (       8):
+  dof 10   d  5.70000000e+01
+Node           9 (       9):
+  dof 10   d  3.48150000e+02
+Node          10 (      10):
+  dof 10   d  3.48150000e+02
+Node          11 (      11):
+  dof 10   d  3.48150000e+02
+Node          12 (      12):
+  dof 10   d  3.48150000e+02
+Node          13 (      13):
+  dof 10   d  7.50000000e+01
+Node          14 (      14):
+  dof 10   d  7.50000000e+01
+Node          15 (      15):
+  dof 10   d  7.50000000e+01
+Node          16 (      16):
+  dof 10   d  7.50000000e+01
+Node          17 (      17):
+  dof 10   d  3.30150000e+02
+Node          18 (      18):
+  dof 10   d  3.30150000e+02
+Node          19 (      19):
+  dof 10   d  3.30150000e+02
+Node          20 (      20):
+  dof 10   d  3.30150000e+02
+Node          21 (      21):
+  dof 10   d  5.70000000e+01
+Node          22 (      22):
+  dof 10   d  5.70000000e+01
+Node          23 (      23):
+  dof 10   d  5.70000000e+01
+Node          24 (      24):
+  dof 10   d  5.70000000e+01
+
+
+
+
+Element output:
+---------------
+element 1 (       1) :
+  GP  1.1  :  state 3.2182e+02   flow -0.0000e+00 -2.2737e-13 -0.0000e+00
+  GP  1.2  :  state 3.2182e+02   flow -0.0000e+00 -2.2737e-13 -0.0000e+00
+  GP  1.3  :  state 3.2182e+02   flow -0.0000e+00 -4.5475e-13 -0.0000e+00
+  GP  1.4  :  state 3.2182e+02   flow -0.0000e+00 -4.5475e-13 -0.0000e+00
+element 2 (       2) :
+  GP  1.1  :  state 4.8667e+01   flow -0.0000e+00 -2.8422e-14 -0.0000e+00
+  GP  1.2  :  state 4.8667e+01   flow -0.0000e+00 -2.8422e-14 -0.0000e+00
+  GP  1.3  :  state 4.8667e+01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 4.8667e+01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+element 3 (       3) :
+  GP  1.1  :  state 3.4815e+02   flow -0.0000e+00 1.1369e-13 -0.0000e+00
+  GP  1.2  :  state 3.4815e+02   flow -0.0000e+00 1.1369e-13 -0.0000e+00
+  GP  1.3  :  state 3.4815e+02   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 3.4815e+02   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+element 4 (       4) :
+  GP  1.1  :  state 7.5000e+01   flow -0.0000e+00 2.8422e-14 -0.0000e+00
+  GP  1.2  :  state 7.5000e+01   flow -0.0000e+00 2.8422e-14 -0.0000e+00
+  GP  1.3  :  state 7.5000e+01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 7.5000e+01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+element 5 (       5) :
+  GP  1.1  :  state 3.2182e+02   flow -0.0000e+00 1.1369e-13 -0.0000e+00
+  GP  1.2  :  state 3.2182e+02   flow -0.0000e+00 1.1369e-13 -0.0000e+00
+  GP  1.3  :  state 3.2182e+02   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 3.2182e+02   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+element 6 (       6) :
+  GP  1.1  :  state 4.8667e+01   flow -0.0000e+00 -1.4211e-14 -0.0000e+00
+  GP  1.2  :  state 4.8667e+01   flow -0.0000e+00 -1.4211e-14 -0.0000e+00
+  GP  1.3  :  state 4.8667e+01   flow -0.0000e+00 5.6843e-14 -0.0000e+00
+  GP  1.4  :  state 4.8667e+01   flow -0.0000e+00 5.6843e-14 -0.0000e+00
+
+
+
+==============================================================
+Output for time 2.00000000e+02 
+==============================================================
+Output for domain   1
+
+
+DofManager output:
+------------------
+Node           1 (       1):
+  dof 10   d  3.00150000e+02
+Node           2 (       2):
+  dof 10   d  3.00150000e+02
+Node           3 (       3):
+  dof 10   d  3.00150000e+02
+Node           4 (       4):
+  dof 10   d  3.00150000e+02
+Node           5 (       5):
+  dof 10   d  2.70000000e+01
+Node           6 (       6):
+  dof 10   d  2.70000000e+01
+Node           7 (       7):
+  dof 10   d  2.70000000e+01
+Node           8 (       8):
+  dof 10   d  2.70000000e+01
+Node           9 (       9):
+  dof 10   d  3.48150000e+02
+Node          10 (      10):
+  dof 10   d  3.48150000e+02
+Node          11 (      11):
+  dof 10   d  3.48150000e+02
+Node          12 (      12):
+  dof 10   d  3.48150000e+02
+Node          13 (      13):
+  dof 10   d  7.50000000e+01
+Node          14 (      14):
+  dof 10   d  7.50000000e+01
+Node          15 (      15):
+  dof 10   d  7.50000000e+01
+Node          16 (      16):
+  dof 10   d  7.50000000e+01
+Node          17 (      17):
+  dof 10   d  3.00150000e+02
+Node          18 (      18):
+  dof 10   d  3.00150000e+02
+Node          19 (      19):
+  dof 10   d  3.00150000e+02
+Node          20 (      20):
+  dof 10   d  3.00150000e+02
+Node          21 (      21):
+  dof 10   d  2.70000000e+01
+Node          22 (      22):
+  dof 10   d  2.70000000e+01
+Node          23 (      23):
+  dof 10   d  2.70000000e+01
+Node          24 (      24):
+  dof 10   d  2.70000000e+01
+
+
+
+
+Element output:
+---------------
+element 1 (       1) :
+  GP  1.1  :  state 3.1515e+02   flow -0.0000e+00 -2.2737e-13 -0.0000e+00
+  GP  1.2  :  state 3.1515e+02   flow -0.0000e+00 -2.2737e-13 -0.0000e+00
+  GP  1.3  :  state 3.1515e+02   flow -0.0000e+00 -4.5475e-13 -0.0000e+00
+  GP  1.4  :  state 3.1515e+02   flow -0.0000e+00 -4.5475e-13 -0.0000e+00
+element 2 (       2) :
+  GP  1.1  :  state 4.2000e+01   flow -0.0000e+00 1.4211e-14 -0.0000e+00
+  GP  1.2  :  state 4.2000e+01   flow -0.0000e+00 1.4211e-14 -0.0000e+00
+  GP  1.3  :  state 4.2000e+01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 4.2000e+01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+element 3 (       3) :
+  GP  1.1  :  state 3.4815e+02   flow -0.0000e+00 1.1369e-13 -0.0000e+00
+  GP  1.2  :  state 3.4815e+02   flow -0.0000e+00 1.1369e-13 -0.0000e+00
+  GP  1.3  :  state 3.4815e+02   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 3.4815e+02   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+element 4 (       4) :
+  GP  1.1  :  state 7.5000e+01   flow -0.0000e+00 2.8422e-14 -0.0000e+00
+  GP  1.2  :  state 7.5000e+01   flow -0.0000e+00 2.8422e-14 -0.0000e+00
+  GP  1.3  :  state 7.5000e+01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 7.5000e+01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+element 5 (       5) :
+  GP  1.1  :  state 3.1515e+02   flow -0.0000e+00 1.1369e-13 -0.0000e+00
+  GP  1.2  :  state 3.1515e+02   flow -0.0000e+00 1.1369e-13 -0.0000e+00
+  GP  1.3  :  state 3.1515e+02   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 3.1515e+02   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+element 6 (       6) :
+  GP  1.1  :  state 4.2000e+01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.2  :  state 4.2000e+01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.3  :  state 4.2000e+01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 4.2000e+01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+
+
+
+==============================================================
+Output for time 5.00000000e+02 
+==============================================================
+Output for domain   1
+
+
+DofManager output:
+------------------
+Node           1 (       1):
+  dof 10   d  2.50150000e+02
+Node           2 (       2):
+  dof 10   d  2.50150000e+02
+Node           3 (       3):
+  dof 10   d  2.50150000e+02
+Node           4 (       4):
+  dof 10   d  2.50150000e+02
+Node           5 (       5):
+  dof 10   d -2.30000000e+01
+Node           6 (       6):
+  dof 10   d -2.30000000e+01
+Node           7 (       7):
+  dof 10   d -2.30000000e+01
+Node           8 (       8):
+  dof 10   d -2.30000000e+01
+Node           9 (       9):
+  dof 10   d  3.48150000e+02
+Node          10 (      10):
+  dof 10   d  3.48150000e+02
+Node          11 (      11):
+  dof 10   d  3.48150000e+02
+Node          12 (      12):
+  dof 10   d  3.48150000e+02
+Node          13 (      13):
+  dof 10   d  7.50000000e+01
+Node          14 (      14):
+  dof 10   d  7.50000000e+01
+Node          15 (      15):
+  dof 10   d  7.50000000e+01
+Node          16 (      16):
+  dof 10   d  7.50000000e+01
+Node          17 (      17):
+  dof 10   d  2.50150000e+02
+Node          18 (      18):
+  dof 10   d  2.50150000e+02
+Node          19 (      19):
+  dof 10   d  2.50150000e+02
+Node          20 (      20):
+  dof 10   d  2.50150000e+02
+Node          21 (      21):
+  dof 10   d -2.30000000e+01
+Node          22 (      22):
+  dof 10   d -2.30000000e+01
+Node          23 (      23):
+  dof 10   d -2.30000000e+01
+Node          24 (      24):
+  dof 10   d -2.30000000e+01
+
+
+
+
+Element output:
+---------------
+element 1 (       1) :
+  GP  1.1  :  state 2.7515e+02   flow -0.0000e+00 -2.2737e-13 -0.0000e+00
+  GP  1.2  :  state 2.7515e+02   flow -0.0000e+00 -2.2737e-13 -0.0000e+00
+  GP  1.3  :  state 2.7515e+02   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 2.7515e+02   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+element 2 (       2) :
+  GP  1.1  :  state 2.0000e+00   flow -0.0000e+00 8.8818e-16 -0.0000e+00
+  GP  1.2  :  state 2.0000e+00   flow -0.0000e+00 8.8818e-16 -0.0000e+00
+  GP  1.3  :  state 2.0000e+00   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 2.0000e+00   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+element 3 (       3) :
+  GP  1.1  :  state 3.4815e+02   flow -0.0000e+00 1.1369e-13 -0.0000e+00
+  GP  1.2  :  state 3.4815e+02   flow -0.0000e+00 1.1369e-13 -0.0000e+00
+  GP  1.3  :  state 3.4815e+02   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 3.4815e+02   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+element 4 (       4) :
+  GP  1.1  :  state 7.5000e+01   flow -0.0000e+00 2.8422e-14 -0.0000e+00
+  GP  1.2  :  state 7.5000e+01   flow -0.0000e+00 2.8422e-14 -0.0000e+00
+  GP  1.3  :  state 7.5000e+01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 7.5000e+01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+element 5 (       5) :
+  GP  1.1  :  state 2.7515e+02   flow -0.0000e+00 1.1369e-13 -0.0000e+00
+  GP  1.2  :  state 2.7515e+02   flow -0.0000e+00 1.1369e-13 -0.0000e+00
+  GP  1.3  :  state 2.7515e+02   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 2.7515e+02   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+element 6 (       6) :
+  GP  1.1  :  state 2.0000e+00   flow -0.0000e+00 -8.8818e-16 -0.0000e+00
+  GP  1.2  :  state 2.0000e+00   flow -0.0000e+00 -8.8818e-16 -0.0000e+00
+  GP  1.3  :  state 2.0000e+00   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 2.0000e+00   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+
+
+
+==============================================================
+Output for time 1.00000000e+03 
+==============================================================
+Output for domain   1
+
+
+DofManager output:
+------------------
+Node           1 (       1):
+  dof 10   d  2.50150000e+02
+Node           2 (       2):
+  dof 10   d  2.50150000e+02
+Node           3 (       3):
+  dof 10   d  2.50150000e+02
+Node           4 (       4):
+  dof 10   d  2.50150000e+02
+Node           5 (       5):
+  dof 10   d -2.30000000e+01
+Node           6 (       6):
+  dof 10   d -2.30000000e+01
+Node           7 (       7):
+  dof 10   d -2.30000000e+01
+Node           8 (       8):
+  dof 10   d -2.30000000e+01
+Node           9 (       9):
+  dof 10   d  3.48150000e+02
+Node          10 (      10):
+  dof 10   d  3.48150000e+02
+Node          11 (      11):
+  dof 10   d  3.48150000e+02
+Node          12 (      12):
+  dof 10   d  3.48150000e+02
+Node          13 (      13):
+  dof 10   d  7.50000000e+01
+Node          14 (      14):
+  dof 10   d  7.50000000e+01
+Node          15 (      15):
+  dof 10   d  7.50000000e+01
+Node          16 (      16):
+  dof 10   d  7.50000000e+01
+Node          17 (      17):
+  dof 10   d  2.50150000e+02
+Node          18 (      18):
+  dof 10   d  2.50150000e+02
+Node          19 (      19):
+  dof 10   d  2.50150000e+02
+Node          20 (      20):
+  dof 10   d  2.50150000e+02
+Node          21 (      21):
+  dof 10   d -2.30000000e+01
+Node          22 (      22):
+  dof 10   d -2.30000000e+01
+Node          23 (      23):
+  dof 10   d -2.30000000e+01
+Node          24 (      24):
+  dof 10   d -2.30000000e+01
+
+
+
+
+Element output:
+---------------
+element 1 (       1) :
+  GP  1.1  :  state 2.5015e+02   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.2  :  state 2.5015e+02   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.3  :  state 2.5015e+02   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 2.5015e+02   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+element 2 (       2) :
+  GP  1.1  :  state -2.3000e+01   flow -0.0000e+00 -7.1054e-15 -0.0000e+00
+  GP  1.2  :  state -2.3000e+01   flow -0.0000e+00 -7.1054e-15 -0.0000e+00
+  GP  1.3  :  state -2.3000e+01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state -2.3000e+01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+element 3 (       3) :
+  GP  1.1  :  state 3.4815e+02   flow -0.0000e+00 1.1369e-13 -0.0000e+00
+  GP  1.2  :  state 3.4815e+02   flow -0.0000e+00 1.1369e-13 -0.0000e+00
+  GP  1.3  :  state 3.4815e+02   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 3.4815e+02   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+element 4 (       4) :
+  GP  1.1  :  state 7.5000e+01   flow -0.0000e+00 2.8422e-14 -0.0000e+00
+  GP  1.2  :  state 7.5000e+01   flow -0.0000e+00 2.8422e-14 -0.0000e+00
+  GP  1.3  :  state 7.5000e+01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 7.5000e+01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+element 5 (       5) :
+  GP  1.1  :  state 2.5015e+02   flow -0.0000e+00 1.1369e-13 -0.0000e+00
+  GP  1.2  :  state 2.5015e+02   flow -0.0000e+00 1.1369e-13 -0.0000e+00
+  GP  1.3  :  state 2.5015e+02   flow -0.0000e+00 2.2737e-13 -0.0000e+00
+  GP  1.4  :  state 2.5015e+02   flow -0.0000e+00 2.2737e-13 -0.0000e+00
+element 6 (       6) :
+  GP  1.1  :  state -2.3000e+01   flow -0.0000e+00 1.4211e-14 -0.0000e+00
+  GP  1.2  :  state -2.3000e+01   flow -0.0000e+00 1.4211e-14 -0.0000e+00
+  GP  1.3  :  state -2.3000e+01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state -2.3000e+01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+
+
+
+==============================================================
+Output for time 2.00000000e+03 
+==============================================================
+Output for domain   1
+
+
+DofManager output:
+------------------
+Node           1 (       1):
+  dof 10   d  3.30150000e+02
+Node           2 (       2):
+  dof 10   d  3.30150000e+02
+Node           3 (       3):
+  dof 10   d  3.30150000e+02
+Node           4 (       4):
+  dof 10   d  3.30150000e+02
+Node           5 (       5):
+  dof 10   d  5.70000000e+01
+Node           6 (       6):
+  dof 10   d  5.70000000e+01
+Node           7 (       7):
+  dof 10   d  5.70000000e+01
+Node           8 (       8):
+  dof 10   d  5.70000000e+01
+Node           9 (       9):
+  dof 10   d  3.48150000e+02
+Node          10 (      10):
+  dof 10   d  3.48150000e+02
+Node          11 (      11):
+  dof 10   d  3.48150000e+02
+Node          12 (      12):
+  dof 10   d  3.48150000e+02
+Node          13 (      13):
+  dof 10   d  7.50000000e+01
+Node          14 (      14):
+  dof 10   d  7.50000000e+01
+Node          15 (      15):
+  dof 10   d  7.50000000e+01
+Node          16 (      16):
+  dof 10   d  7.50000000e+01
+Node          17 (      17):
+  dof 10   d  3.30150000e+02
+Node          18 (      18):
+  dof 10   d  3.30150000e+02
+Node          19 (      19):
+  dof 10   d  3.30150000e+02
+Node          20 (      20):
+  dof 10   d  3.30150000e+02
+Node          21 (      21):
+  dof 10   d  5.70000000e+01
+Node          22 (      22):
+  dof 10   d  5.70000000e+01
+Node          23 (      23):
+  dof 10   d  5.70000000e+01
+Node          24 (      24):
+  dof 10   d  5.70000000e+01
+
+
+
+
+Element output:
+---------------
+element 1 (       1) :
+  GP  1.1  :  state 2.9015e+02   flow -0.0000e+00 1.1369e-13 -0.0000e+00
+  GP  1.2  :  state 2.9015e+02   flow -0.0000e+00 1.1369e-13 -0.0000e+00
+  GP  1.3  :  state 2.9015e+02   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 2.9015e+02   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+element 2 (       2) :
+  GP  1.1  :  state 1.7000e+01   flow -0.0000e+00 -7.1054e-15 -0.0000e+00
+  GP  1.2  :  state 1.7000e+01   flow -0.0000e+00 -7.1054e-15 -0.0000e+00
+  GP  1.3  :  state 1.7000e+01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 1.7000e+01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+element 3 (       3) :
+  GP  1.1  :  state 3.4815e+02   flow -0.0000e+00 1.1369e-13 -0.0000e+00
+  GP  1.2  :  state 3.4815e+02   flow -0.0000e+00 1.1369e-13 -0.0000e+00
+  GP  1.3  :  state 3.4815e+02   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 3.4815e+02   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+element 4 (       4) :
+  GP  1.1  :  state 7.5000e+01   flow -0.0000e+00 2.8422e-14 -0.0000e+00
+  GP  1.2  :  state 7.5000e+01   flow -0.0000e+00 2.8422e-14 -0.0000e+00
+  GP  1.3  :  state 7.5000e+01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 7.5000e+01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+element 5 (       5) :
+  GP  1.1  :  state 2.9015e+02   flow -0.0000e+00 -1.1369e-13 -0.0000e+00
+  GP  1.2  :  state 2.9015e+02   flow -0.0000e+00 -1.1369e-13 -0.0000e+00
+  GP  1.3  :  state 2.9015e+02   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 2.9015e+02   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+element 6 (       6) :
+  GP  1.1  :  state 1.7000e+01   flow -0.0000e+00 -1.4211e-14 -0.0000e+00
+  GP  1.2  :  state 1.7000e+01   flow -0.0000e+00 -1.4211e-14 -0.0000e+00
+  GP  1.3  :  state 1.7000e+01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 1.7000e+01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+
+
+
+==============================================================
+Output for time 5.00000000e+03 
+==============================================================
+Output for domain   1
+
+
+DofManager output:
+------------------
+Node           1 (       1):
+  dof 10   d  2.98150000e+02
+Node           2 (       2):
+  dof 10   d  2.98150000e+02
+Node           3 (       3):
+  dof 10   d  2.98150000e+02
+Node           4 (       4):
+  dof 10   d  2.98150000e+02
+Node           5 (       5):
+  dof 10   d  2.50000000e+01
+Node           6 (       6):
+  dof 10   d  2.50000000e+01
+Node           7 (       7):
+  dof 10   d  2.50000000e+01
+Node           8 (       8):
+  dof 10   d  2.50000000e+01
+Node           9 (       9):
+  dof 10   d  3.48150000e+02
+Node          10 (      10):
+  dof 10   d  3.48150000e+02
+Node          11 (      11):
+  dof 10   d  3.48150000e+02
+Node          12 (      12):
+  dof 10   d  3.48150000e+02
+Node          13 (      13):
+  dof 10   d  7.50000000e+01
+Node          14 (      14):
+  dof 10   d  7.50000000e+01
+Node          15 (      15):
+  dof 10   d  7.50000000e+01
+Node          16 (      16):
+  dof 10   d  7.50000000e+01
+Node          17 (      17):
+  dof 10   d  2.98150000e+02
+Node          18 (      18):
+  dof 10   d  2.98150000e+02
+Node          19 (      19):
+  dof 10   d  2.98150000e+02
+Node          20 (      20):
+  dof 10   d  2.98150000e+02
+Node          21 (      21):
+  dof 10   d  2.50000000e+01
+Node          22 (      22):
+  dof 10   d  2.50000000e+01
+Node          23 (      23):
+  dof 10   d  2.50000000e+01
+Node          24 (      24):
+  dof 10   d  2.50000000e+01
+
+
+
+
+Element output:
+---------------
+element 1 (       1) :
+  GP  1.1  :  state 3.1415e+02   flow -0.0000e+00 -2.2737e-13 -0.0000e+00
+  GP  1.2  :  state 3.1415e+02   flow -0.0000e+00 -2.2737e-13 -0.0000e+00
+  GP  1.3  :  state 3.1415e+02   flow -0.0000e+00 -4.5475e-13 -0.0000e+00
+  GP  1.4  :  state 3.1415e+02   flow -0.0000e+00 -4.5475e-13 -0.0000e+00
+element 2 (       2) :
+  GP  1.1  :  state 4.1000e+01   flow -0.0000e+00 1.4211e-14 -0.0000e+00
+  GP  1.2  :  state 4.1000e+01   flow -0.0000e+00 1.4211e-14 -0.0000e+00
+  GP  1.3  :  state 4.1000e+01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 4.1000e+01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+element 3 (       3) :
+  GP  1.1  :  state 3.4815e+02   flow -0.0000e+00 1.1369e-13 -0.0000e+00
+  GP  1.2  :  state 3.4815e+02   flow -0.0000e+00 1.1369e-13 -0.0000e+00
+  GP  1.3  :  state 3.4815e+02   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 3.4815e+02   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+element 4 (       4) :
+  GP  1.1  :  state 7.5000e+01   flow -0.0000e+00 2.8422e-14 -0.0000e+00
+  GP  1.2  :  state 7.5000e+01   flow -0.0000e+00 2.8422e-14 -0.0000e+00
+  GP  1.3  :  state 7.5000e+01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 7.5000e+01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+element 5 (       5) :
+  GP  1.1  :  state 3.1415e+02   flow -0.0000e+00 1.1369e-13 -0.0000e+00
+  GP  1.2  :  state 3.1415e+02   flow -0.0000e+00 1.1369e-13 -0.0000e+00
+  GP  1.3  :  state 3.1415e+02   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 3.1415e+02   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+element 6 (       6) :
+  GP  1.1  :  state 4.1000e+01   flow -0.0000e+00 1.4211e-14 -0.0000e+00
+  GP  1.2  :  state 4.1000e+01   flow -0.0000e+00 1.4211e-14 -0.0000e+00
+  GP  1.3  :  state 4.1000e+01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 4.1000e+01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+
+
+
+==============================================================
+Output for time 1.00000000e+04 
+==============================================================
+Output for domain   1
+
+
+DofManager output:
+------------------
+Node           1 (       1):
+  dof 10   d  2.98150000e+02
+Node           2 (       2):
+  dof 10   d  2.98150000e+02
+Node           3 (       3):
+  dof 10   d  2.98150000e+02
+Node           4 (       4):
+  dof 10   d  2.98150000e+02
+Node           5 (       5):
+  dof 10   d  2.50000000e+01
+Node           6 (       6):
+  dof 10   d  2.50000000e+01
+Node           7 (       7):
+  dof 10   d  2.50000000e+01
+Node           8 (       8):
+  dof 10   d  2.50000000e+01
+Node           9 (       9):
+  dof 10   d  3.48150000e+02
+Node          10 (      10):
+  dof 10   d  3.48150000e+02
+Node          11 (      11):
+  dof 10   d  3.48150000e+02
+Node          12 (      12):
+  dof 10   d  3.48150000e+02
+Node          13 (      13):
+  dof 10   d  7.50000000e+01
+Node          14 (      14):
+  dof 10   d  7.50000000e+01
+Node          15 (      15):
+  dof 10   d  7.50000000e+01
+Node          16 (      16):
+  dof 10   d  7.50000000e+01
+Node          17 (      17):
+  dof 10   d  2.98150000e+02
+Node          18 (      18):
+  dof 10   d  2.98150000e+02
+Node          19 (      19):
+  dof 10   d  2.98150000e+02
+Node          20 (      20):
+  dof 10   d  2.98150000e+02
+Node          21 (      21):
+  dof 10   d  2.50000000e+01
+Node          22 (      22):
+  dof 10   d  2.50000000e+01
+Node          23 (      23):
+  dof 10   d  2.50000000e+01
+Node          24 (      24):
+  dof 10   d  2.50000000e+01
+
+
+
+
+Element output:
+---------------
+element 1 (       1) :
+  GP  1.1  :  state 2.9815e+02   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.2  :  state 2.9815e+02   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.3  :  state 2.9815e+02   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 2.9815e+02   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+element 2 (       2) :
+  GP  1.1  :  state 2.5000e+01   flow -0.0000e+00 1.4211e-14 -0.0000e+00
+  GP  1.2  :  state 2.5000e+01   flow -0.0000e+00 1.4211e-14 -0.0000e+00
+  GP  1.3  :  state 2.5000e+01   flow -0.0000e+00 2.8422e-14 -0.0000e+00
+  GP  1.4  :  state 2.5000e+01   flow -0.0000e+00 2.8422e-14 -0.0000e+00
+element 3 (       3) :
+  GP  1.1  :  state 3.4815e+02   flow -0.0000e+00 1.1369e-13 -0.0000e+00
+  GP  1.2  :  state 3.4815e+02   flow -0.0000e+00 1.1369e-13 -0.0000e+00
+  GP  1.3  :  state 3.4815e+02   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 3.4815e+02   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+element 4 (       4) :
+  GP  1.1  :  state 7.5000e+01   flow -0.0000e+00 2.8422e-14 -0.0000e+00
+  GP  1.2  :  state 7.5000e+01   flow -0.0000e+00 2.8422e-14 -0.0000e+00
+  GP  1.3  :  state 7.5000e+01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 7.5000e+01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+element 5 (       5) :
+  GP  1.1  :  state 2.9815e+02   flow -0.0000e+00 -1.1369e-13 -0.0000e+00
+  GP  1.2  :  state 2.9815e+02   flow -0.0000e+00 -1.1369e-13 -0.0000e+00
+  GP  1.3  :  state 2.9815e+02   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 2.9815e+02   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+element 6 (       6) :
+  GP  1.1  :  state 2.5000e+01   flow -0.0000e+00 -7.1054e-15 -0.0000e+00
+  GP  1.2  :  state 2.5000e+01   flow -0.0000e+00 -7.1054e-15 -0.0000e+00
+  GP  1.3  :  state 2.5000e+01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 2.5000e+01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+
+
@@ -0,0 +1,1063 @@
+############################################################## www.oofem.org ###
+       ####    ####   ######  ######  #    #
+     #    #  #    #  #       #       ##  ##
+    #    #  #    #  #####   #####   # ## #
+   #    #  #    #  #       #       #    #
+  #    #  #    #  #       #       #    #   OOFEM ver. 2.6
+  ####    ####   #       ######  #    #    Copyright (C) 1994-2017 Borek Patzak
+################################################################################
+
+
+Starting analysis on: Sun Oct 18 13:03:59 2026
+
+tests on creep with damage
+
+==============================================================
+Output for time 1.00000000e-10 
+==============================================================
+Output for domain   1
+
+
+DofManager output:
+------------------
+Node           1 (       1):
+  dof 14   d  9.80000000e-01
+Node           2 (       2):
+  dof 14   d  9.80000000e-01
+Node           3 (       3):
+  dof 14   d  9.80000000e-01
+Node           4 (       4):
+  dof 14   d  9.80000000e-01
+
+
+
+
+Element output:
+---------------
+element 1 (       1) :
+  GP  1.1  :  state 9.8000e-01   flow -0.0000e+00 -2.7756e-22 -0.0000e+00
+  GP  1.2  :  state 9.8000e-01   flow -0.0000e+00 -2.7756e-22 -0.0000e+00
+  GP  1.3  :  state 9.8000e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 9.8000e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+
+
+
+==============================================================
+Output for time 1.00000000e-04 
+==============================================================
+Output for domain   1
+
+
+DofManager output:
+------------------
+Node           1 (       1):
+  dof 14   d  9.80000000e-01
+Node           2 (       2):
+  dof 14   d  9.80000000e-01
+Node           3 (       3):
+  dof 14   d  9.80000000e-01
+Node           4 (       4):
+  dof 14   d  9.80000000e-01
+
+
+
+
+Element output:
+---------------
+element 1 (       1) :
+  GP  1.1  :  state 9.8000e-01   flow -0.0000e+00 -2.7756e-22 -0.0000e+00
+  GP  1.2  :  state 9.8000e-01   flow -0.0000e+00 -2.7756e-22 -0.0000e+00
+  GP  1.3  :  state 9.8000e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 9.8000e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+
+
+
+==============================================================
+Output for time 2.00000000e-04 
+==============================================================
+Output for domain   1
+
+
+DofManager output:
+------------------
+Node           1 (       1):
+  dof 14   d  9.80000000e-01
+Node           2 (       2):
+  dof 14   d  9.80000000e-01
+Node           3 (       3):
+  dof 14   d  9.80000000e-01
+Node           4 (       4):
+  dof 14   d  9.80000000e-01
+
+
+
+
+Element output:
+---------------
+element 1 (       1) :
+  GP  1.1  :  state 9.8000e-01   flow -0.0000e+00 -2.7756e-22 -0.0000e+00
+  GP  1.2  :  state 9.8000e-01   flow -0.0000e+00 -2.7756e-22 -0.0000e+00
+  GP  1.3  :  state 9.8000e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 9.8000e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+
+
+
+==============================================================
+Output for time 5.00000000e-04 
+==============================================================
+Output for domain   1
+
+
+DofManager output:
+------------------
+Node           1 (       1):
+  dof 14   d  9.80000000e-01
+Node           2 (       2):
+  dof 14   d  9.80000000e-01
+Node           3 (       3):
+  dof 14   d  9.80000000e-01
+Node           4 (       4):
+  dof 14   d  9.80000000e-01
+
+
+
+
+Element output:
+---------------
+element 1 (       1) :
+  GP  1.1  :  state 9.8000e-01   flow -0.0000e+00 -2.7756e-22 -0.0000e+00
+  GP  1.2  :  state 9.8000e-01   flow -0.0000e+00 -2.7756e-22 -0.0000e+00
+  GP  1.3  :  state 9.8000e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 9.8000e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+
+
+
+==============================================================
+Output for time 1.00000000e-03 
+==============================================================
+Output for domain   1
+
+
+DofManager output:
+------------------
+Node           1 (       1):
+  dof 14   d  9.80000000e-01
+Node           2 (       2):
+  dof 14   d  9.80000000e-01
+Node           3 (       3):
+  dof 14   d  9.80000000e-01
+Node           4 (       4):
+  dof 14   d  9.80000000e-01
+
+
+
+
+Element output:
+---------------
+element 1 (       1) :
+  GP  1.1  :  state 9.8000e-01   flow -0.0000e+00 -2.7756e-22 -0.0000e+00
+  GP  1.2  :  state 9.8000e-01   flow -0.0000e+00 -2.7756e-22 -0.0000e+00
+  GP  1.3  :  state 9.8000e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 9.8000e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+
+
+
+==============================================================
+Output for time 2.00000000e-03 
+==============================================================
+Output for domain   1
+
+
+DofManager output:
+------------------
+Node           1 (       1):
+  dof 14   d  9.80000000e-01
+Node           2 (       2):
+  dof 14   d  9.80000000e-01
+Node           3 (       3):
+  dof 14   d  9.80000000e-01
+Node           4 (       4):
+  dof 14   d  9.80000000e-01
+
+
+
+
+Element output:
+---------------
+element 1 (       1) :
+  GP  1.1  :  state 9.8000e-01   flow -0.0000e+00 -2.7756e-22 -0.0000e+00
+  GP  1.2  :  state 9.8000e-01   flow -0.0000e+00 -2.7756e-22 -0.0000e+00
+  GP  1.3  :  state 9.8000e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 9.8000e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+
+
+
+==============================================================
+Output for time 5.00000000e-03 
+==============================================================
+Output for domain   1
+
+
+DofManager output:
+------------------
+Node           1 (       1):
+  dof 14   d  9.80000000e-01
+Node           2 (       2):
+  dof 14   d  9.80000000e-01
+Node           3 (       3):
+  dof 14   d  9.80000000e-01
+Node           4 (       4):
+  dof 14   d  9.80000000e-01
+
+
+
+
+Element output:
+---------------
+element 1 (       1) :
+  GP  1.1  :  state 9.8000e-01   flow -0.0000e+00 -2.7756e-22 -0.0000e+00
+  GP  1.2  :  state 9.8000e-01   flow -0.0000e+00 -2.7756e-22 -0.0000e+00
+  GP  1.3  :  state 9.8000e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 9.8000e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+
+
+
+==============================================================
+Output for time 1.00000000e-02 
+==============================================================
+Output for domain   1
+
+
+DofManager output:
+------------------
+Node           1 (       1):
+  dof 14   d  9.80000000e-01
+Node           2 (       2):
+  dof 14   d  9.80000000e-01
+Node           3 (       3):
+  dof 14   d  9.80000000e-01
+Node           4 (       4):
+  dof 14   d  9.80000000e-01
+
+
+
+
+Element output:
+---------------
+element 1 (       1) :
+  GP  1.1  :  state 9.8000e-01   flow -0.0000e+00 -2.7756e-22 -0.0000e+00
+  GP  1.2  :  state 9.8000e-01   flow -0.0000e+00 -2.7756e-22 -0.0000e+00
+  GP  1.3  :  state 9.8000e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 9.8000e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+
+
+
+==============================================================
+Output for time 2.00000000e-02 
+==============================================================
+Output for domain   1
+
+
+DofManager output:
+------------------
+Node           1 (       1):
+  dof 14   d  9.80000000e-01
+Node           2 (       2):
+  dof 14   d  9.80000000e-01
+Node           3 (       3):
+  dof 14   d  9.80000000e-01
+Node           4 (       4):
+  dof 14   d  9.80000000e-01
+
+
+
+
+Element output:
+---------------
+element 1 (       1) :
+  GP  1.1  :  state 9.8000e-01   flow -0.0000e+00 -2.7756e-22 -0.0000e+00
+  GP  1.2  :  state 9.8000e-01   flow -0.0000e+00 -2.7756e-22 -0.0000e+00
+  GP  1.3  :  state 9.8000e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 9.8000e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+
+
+
+==============================================================
+Output for time 5.00000000e-02 
+==============================================================
+Output for domain   1
+
+
+DofManager output:
+------------------
+Node           1 (       1):
+  dof 14   d  9.80000000e-01
+Node           2 (       2):
+  dof 14   d  9.80000000e-01
+Node           3 (       3):
+  dof 14   d  9.80000000e-01
+Node           4 (       4):
+  dof 14   d  9.80000000e-01
+
+
+
+
+Element output:
+---------------
+element 1 (       1) :
+  GP  1.1  :  state 9.8000e-01   flow -0.0000e+00 -2.7756e-22 -0.0000e+00
+  GP  1.2  :  state 9.8000e-01   flow -0.0000e+00 -2.7756e-22 -0.0000e+00
+  GP  1.3  :  state 9.8000e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 9.8000e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+
+
+
+==============================================================
+Output for time 1.00000000e-01 
+==============================================================
+Output for domain   1
+
+
+DofManager output:
+------------------
+Node           1 (       1):
+  dof 14   d  9.80000000e-01
+Node           2 (       2):
+  dof 14   d  9.80000000e-01
+Node           3 (       3):
+  dof 14   d  9.80000000e-01
+Node           4 (       4):
+  dof 14   d  9.80000000e-01
+
+
+
+
+Element output:
+---------------
+element 1 (       1) :
+  GP  1.1  :  state 9.8000e-01   flow -0.0000e+00 -2.7756e-22 -0.0000e+00
+  GP  1.2  :  state 9.8000e-01   flow -0.0000e+00 -2.7756e-22 -0.0000e+00
+  GP  1.3  :  state 9.8000e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 9.8000e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+
+
+
+==============================================================
+Output for time 2.00000000e-01 
+==============================================================
+Output for domain   1
+
+
+DofManager output:
+------------------
+Node           1 (       1):
+  dof 14   d  9.71111111e-01
+Node           2 (       2):
+  dof 14   d  9.71111111e-01
+Node           3 (       3):
+  dof 14   d  9.71111111e-01
+Node           4 (       4):
+  dof 14   d  9.71111111e-01
+
+
+
+
+Element output:
+---------------
+element 1 (       1) :
+  GP  1.1  :  state 9.7556e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.2  :  state 9.7556e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.3  :  state 9.7556e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 9.7556e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+
+
+
+==============================================================
+Output for time 5.00000000e-01 
+==============================================================
+Output for domain   1
+
+
+DofManager output:
+------------------
+Node           1 (       1):
+  dof 14   d  9.44444444e-01
+Node           2 (       2):
+  dof 14   d  9.44444444e-01
+Node           3 (       3):
+  dof 14   d  9.44444444e-01
+Node           4 (       4):
+  dof 14   d  9.44444444e-01
+
+
+
+
+Element output:
+---------------
+element 1 (       1) :
+  GP  1.1  :  state 9.5778e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.2  :  state 9.5778e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.3  :  state 9.5778e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 9.5778e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+
+
+
+==============================================================
+Output for time 1.00000000e+00 
+==============================================================
+Output for domain   1
+
+
+DofManager output:
+------------------
+Node           1 (       1):
+  dof 14   d  9.00000000e-01
+Node           2 (       2):
+  dof 14   d  9.00000000e-01
+Node           3 (       3):
+  dof 14   d  9.00000000e-01
+Node           4 (       4):
+  dof 14   d  9.00000000e-01
+
+
+
+
+Element output:
+---------------
+element 1 (       1) :
+  GP  1.1  :  state 9.2222e-01   flow -0.0000e+00 -2.7756e-22 -0.0000e+00
+  GP  1.2  :  state 9.2222e-01   flow -0.0000e+00 -2.7756e-22 -0.0000e+00
+  GP  1.3  :  state 9.2222e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 9.2222e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+
+
+
+==============================================================
+Output for time 2.00000000e+00 
+==============================================================
+Output for domain   1
+
+
+DofManager output:
+------------------
+Node           1 (       1):
+  dof 14   d  8.88888889e-01
+Node           2 (       2):
+  dof 14   d  8.88888889e-01
+Node           3 (       3):
+  dof 14   d  8.88888889e-01
+Node           4 (       4):
+  dof 14   d  8.88888889e-01
+
+
+
+
+Element output:
+---------------
+element 1 (       1) :
+  GP  1.1  :  state 8.9444e-01   flow -0.0000e+00 2.7756e-22 -0.0000e+00
+  GP  1.2  :  state 8.9444e-01   flow -0.0000e+00 2.7756e-22 -0.0000e+00
+  GP  1.3  :  state 8.9444e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 8.9444e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+
+
+
+==============================================================
+Output for time 5.00000000e+00 
+==============================================================
+Output for domain   1
+
+
+DofManager output:
+------------------
+Node           1 (       1):
+  dof 14   d  8.55555556e-01
+Node           2 (       2):
+  dof 14   d  8.55555556e-01
+Node           3 (       3):
+  dof 14   d  8.55555556e-01
+Node           4 (       4):
+  dof 14   d  8.55555556e-01
+
+
+
+
+Element output:
+---------------
+element 1 (       1) :
+  GP  1.1  :  state 8.7222e-01   flow -0.0000e+00 -2.7756e-22 -0.0000e+00
+  GP  1.2  :  state 8.7222e-01   flow -0.0000e+00 -2.7756e-22 -0.0000e+00
+  GP  1.3  :  state 8.7222e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 8.7222e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+
+
+
+==============================================================
+Output for time 1.00000000e+01 
+==============================================================
+Output for domain   1
+
+
+DofManager output:
+------------------
+Node           1 (       1):
+  dof 14   d  8.00000000e-01
+Node           2 (       2):
+  dof 14   d  8.00000000e-01
+Node           3 (       3):
+  dof 14   d  8.00000000e-01
+Node           4 (       4):
+  dof 14   d  8.00000000e-01
+
+
+
+
+Element output:
+---------------
+element 1 (       1) :
+  GP  1.1  :  state 8.2778e-01   flow -0.0000e+00 -5.5511e-22 -0.0000e+00
+  GP  1.2  :  state 8.2778e-01   flow -0.0000e+00 -5.5511e-22 -0.0000e+00
+  GP  1.3  :  state 8.2778e-01   flow -0.0000e+00 -1.1102e-21 -0.0000e+00
+  GP  1.4  :  state 8.2778e-01   flow -0.0000e+00 -1.1102e-21 -0.0000e+00
+
+
+
+==============================================================
+Output for time 2.00000000e+01 
+==============================================================
+Output for domain   1
+
+
+DofManager output:
+------------------
+Node           1 (       1):
+  dof 14   d  7.88888889e-01
+Node           2 (       2):
+  dof 14   d  7.88888889e-01
+Node           3 (       3):
+  dof 14   d  7.88888889e-01
+Node           4 (       4):
+  dof 14   d  7.88888889e-01
+
+
+
+
+Element output:
+---------------
+element 1 (       1) :
+  GP  1.1  :  state 7.9444e-01   flow -0.0000e+00 5.5511e-22 -0.0000e+00
+  GP  1.2  :  state 7.9444e-01   flow -0.0000e+00 5.5511e-22 -0.0000e+00
+  GP  1.3  :  state 7.9444e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 7.9444e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+
+
+
+==============================================================
+Output for time 5.00000000e+01 
+==============================================================
+Output for domain   1
+
+
+DofManager output:
+------------------
+Node           1 (       1):
+  dof 14   d  7.55555556e-01
+Node           2 (       2):
+  dof 14   d  7.55555556e-01
+Node           3 (       3):
+  dof 14   d  7.55555556e-01
+Node           4 (       4):
+  dof 14   d  7.55555556e-01
+
+
+
+
+Element output:
+---------------
+element 1 (       1) :
+  GP  1.1  :  state 7.7222e-01   flow -0.0000e+00 -2.7756e-22 -0.0000e+00
+  GP  1.2  :  state 7.7222e-01   flow -0.0000e+00 -2.7756e-22 -0.0000e+00
+  GP  1.3  :  state 7.7222e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 7.7222e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+
+
+
+==============================================================
+Output for time 6.00000000e+01 
+==============================================================
+Output for domain   1
+
+
+DofManager output:
+------------------
+Node           1 (       1):
+  dof 14   d  7.44444444e-01
+Node           2 (       2):
+  dof 14   d  7.44444444e-01
+Node           3 (       3):
+  dof 14   d  7.44444444e-01
+Node           4 (       4):
+  dof 14   d  7.44444444e-01
+
+
+
+
+Element output:
+---------------
+element 1 (       1) :
+  GP  1.1  :  state 7.5000e-01   flow -0.0000e+00 2.7756e-22 -0.0000e+00
+  GP  1.2  :  state 7.5000e-01   flow -0.0000e+00 2.7756e-22 -0.0000e+00
+  GP  1.3  :  state 7.5000e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 7.5000e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+
+
+
+==============================================================
+Output for time 7.00000000e+01 
+==============================================================
+Output for domain   1
+
+
+DofManager output:
+------------------
+Node           1 (       1):
+  dof 14   d  7.33333333e-01
+Node           2 (       2):
+  dof 14   d  7.33333333e-01
+Node           3 (       3):
+  dof 14   d  7.33333333e-01
+Node           4 (       4):
+  dof 14   d  7.33333333e-01
+
+
+
+
+Element output:
+---------------
+element 1 (       1) :
+  GP  1.1  :  state 7.3889e-01   flow -0.0000e+00 -2.7756e-22 -0.0000e+00
+  GP  1.2  :  state 7.3889e-01   flow -0.0000e+00 -2.7756e-22 -0.0000e+00
+  GP  1.3  :  state 7.3889e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 7.3889e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+
+
+
+==============================================================
+Output for time 8.00000000e+01 
+==============================================================
+Output for domain   1
+
+
+DofManager output:
+------------------
+Node           1 (       1):
+  dof 14   d  7.22222222e-01
+Node           2 (       2):
+  dof 14   d  7.22222222e-01
+Node           3 (       3):
+  dof 14   d  7.22222222e-01
+Node           4 (       4):
+  dof 14   d  7.22222222e-01
+
+
+
+
+Element output:
+---------------
+element 1 (       1) :
+  GP  1.1  :  state 7.2778e-01   flow -0.0000e+00 -2.7756e-22 -0.0000e+00
+  GP  1.2  :  state 7.2778e-01   flow -0.0000e+00 -2.7756e-22 -0.0000e+00
+  GP  1.3  :  state 7.2778e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 7.2778e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+
+
+
+==============================================================
+Output for time 9.00000000e+01 
+==============================================================
+Output for domain   1
+
+
+DofManager output:
+------------------
+Node           1 (       1):
+  dof 14   d  7.11111111e-01
+Node           2 (       2):
+  dof 14   d  7.11111111e-01
+Node           3 (       3):
+  dof 14   d  7.11111111e-01
+Node           4 (       4):
+  dof 14   d  7.11111111e-01
+
+
+
+
+Element output:
+---------------
+element 1 (       1) :
+  GP  1.1  :  state 7.1667e-01   flow -0.0000e+00 5.5511e-22 -0.0000e+00
+  GP  1.2  :  state 7.1667e-01   flow -0.0000e+00 5.5511e-22 -0.0000e+00
+  GP  1.3  :  state 7.1667e-01   flow -0.0000e+00 1.1102e-21 -0.0000e+00
+  GP  1.4  :  state 7.1667e-01   flow -0.0000e+00 1.1102e-21 -0.0000e+00
+
+
+
+==============================================================
+Output for time 1.00000000e+02 
+==============================================================
+Output for domain   1
+
+
+DofManager output:
+------------------
+Node           1 (       1):
+  dof 14   d  7.00000000e-01
+Node           2 (       2):
+  dof 14   d  7.00000000e-01
+Node           3 (       3):
+  dof 14   d  7.00000000e-01
+Node           4 (       4):
+  dof 14   d  7.00000000e-01
+
+
+
+
+Element output:
+---------------
+element 1 (       1) :
+  GP  1.1  :  state 7.0556e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.2  :  state 7.0556e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.3  :  state 7.0556e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 7.0556e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+
+
+
+==============================================================
+Output for time 2.00000000e+02 
+==============================================================
+Output for domain   1
+
+
+DofManager output:
+------------------
+Node           1 (       1):
+  dof 14   d  6.88888889e-01
+Node           2 (       2):
+  dof 14   d  6.88888889e-01
+Node           3 (       3):
+  dof 14   d  6.88888889e-01
+Node           4 (       4):
+  dof 14   d  6.88888889e-01
+
+
+
+
+Element output:
+---------------
+element 1 (       1) :
+  GP  1.1  :  state 6.9444e-01   flow -0.0000e+00 -2.7756e-22 -0.0000e+00
+  GP  1.2  :  state 6.9444e-01   flow -0.0000e+00 -2.7756e-22 -0.0000e+00
+  GP  1.3  :  state 6.9444e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 6.9444e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+
+
+
+==============================================================
+Output for time 5.00000000e+02 
+==============================================================
+Output for domain   1
+
+
+DofManager output:
+------------------
+Node           1 (       1):
+  dof 14   d  6.55555556e-01
+Node           2 (       2):
+  dof 14   d  6.55555556e-01
+Node           3 (       3):
+  dof 14   d  6.55555556e-01
+Node           4 (       4):
+  dof 14   d  6.55555556e-01
+
+
+
+
+Element output:
+---------------
+element 1 (       1) :
+  GP  1.1  :  state 6.7222e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.2  :  state 6.7222e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.3  :  state 6.7222e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 6.7222e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+
+
+
+==============================================================
+Output for time 6.00000000e+02 
+==============================================================
+Output for domain   1
+
+
+DofManager output:
+------------------
+Node           1 (       1):
+  dof 14   d  6.44444444e-01
+Node           2 (       2):
+  dof 14   d  6.44444444e-01
+Node           3 (       3):
+  dof 14   d  6.44444444e-01
+Node           4 (       4):
+  dof 14   d  6.44444444e-01
+
+
+
+
+Element output:
+---------------
+element 1 (       1) :
+  GP  1.1  :  state 6.5000e-01   flow -0.0000e+00 -5.5511e-22 -0.0000e+00
+  GP  1.2  :  state 6.5000e-01   flow -0.0000e+00 -5.5511e-22 -0.0000e+00
+  GP  1.3  :  state 6.5000e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 6.5000e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+
+
+
+==============================================================
+Output for time 7.00000000e+02 
+==============================================================
+Output for domain   1
+
+
+DofManager output:
+------------------
+Node           1 (       1):
+  dof 14   d  6.33333333e-01
+Node           2 (       2):
+  dof 14   d  6.33333333e-01
+Node           3 (       3):
+  dof 14   d  6.33333333e-01
+Node           4 (       4):
+  dof 14   d  6.33333333e-01
+
+
+
+
+Element output:
+---------------
+element 1 (       1) :
+  GP  1.1  :  state 6.3889e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.2  :  state 6.3889e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.3  :  state 6.3889e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 6.3889e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+
+
+
+==============================================================
+Output for time 8.00000000e+02 
+==============================================================
+Output for domain   1
+
+
+DofManager output:
+------------------
+Node           1 (       1):
+  dof 14   d  6.22222222e-01
+Node           2 (       2):
+  dof 14   d  6.22222222e-01
+Node           3 (       3):
+  dof 14   d  6.22222222e-01
+Node           4 (       4):
+  dof 14   d  6.22222222e-01
+
+
+
+
+Element output:
+---------------
+element 1 (       1) :
+  GP  1.1  :  state 6.2778e-01   flow -0.0000e+00 2.7756e-22 -0.0000e+00
+  GP  1.2  :  state 6.2778e-01   flow -0.0000e+00 2.7756e-22 -0.0000e+00
+  GP  1.3  :  state 6.2778e-01   flow -0.0000e+00 5.5511e-22 -0.0000e+00
+  GP  1.4  :  state 6.2778e-01   flow -0.0000e+00 5.5511e-22 -0.0000e+00
+
+
+
+==============================================================
+Output for time 9.00000000e+02 
+==============================================================
+Output for domain   1
+
+
+DofManager output:
+------------------
+Node           1 (       1):
+  dof 14   d  6.11111111e-01
+Node           2 (       2):
+  dof 14   d  6.11111111e-01
+Node           3 (       3):
+  dof 14   d  6.11111111e-01
+Node           4 (       4):
+  dof 14   d  6.11111111e-01
+
+
+
+
+Element output:
+---------------
+element 1 (       1) :
+  GP  1.1  :  state 6.1667e-01   flow -0.0000e+00 -2.7756e-22 -0.0000e+00
+  GP  1.2  :  state 6.1667e-01   flow -0.0000e+00 -2.7756e-22 -0.0000e+00
+  GP  1.3  :  state 6.1667e-01   flow -0.0000e+00 -5.5511e-22 -0.0000e+00
+  GP  1.4  :  state 6.1667e-01   flow -0.0000e+00 -5.5511e-22 -0.0000e+00
+
+
+
+==============================================================
+Output for time 1.00000000e+03 
+==============================================================
+Output for domain   1
+
+
+DofManager output:
+------------------
+Node           1 (       1):
+  dof 14   d  6.00000000e-01
+Node           2 (       2):
+  dof 14   d  6.00000000e-01
+Node           3 (       3):
+  dof 14   d  6.00000000e-01
+Node           4 (       4):
+  dof 14   d  6.00000000e-01
+
+
+
+
+Element output:
+---------------
+element 1 (       1) :
+  GP  1.1  :  state 6.0556e-01   flow -0.0000e+00 2.7756e-22 -0.0000e+00
+  GP  1.2  :  state 6.0556e-01   flow -0.0000e+00 2.7756e-22 -0.0000e+00
+  GP  1.3  :  state 6.0556e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 6.0556e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+
+
+
+==============================================================
+Output for time 1.50000000e+03 
+==============================================================
+Output for domain   1
+
+
+DofManager output:
+------------------
+Node           1 (       1):
+  dof 14   d  5.94444444e-01
+Node           2 (       2):
+  dof 14   d  5.94444444e-01
+Node           3 (       3):
+  dof 14   d  5.94444444e-01
+Node           4 (       4):
+  dof 14   d  5.94444444e-01
+
+
+
+
+Element output:
+---------------
+element 1 (       1) :
+  GP  1.1  :  state 5.9722e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.2  :  state 5.9722e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.3  :  state 5.9722e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 5.9722e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+
+
+
+==============================================================
+Output for time 2.00000000e+03 
+==============================================================
+Output for domain   1
+
+
+DofManager output:
+------------------
+Node           1 (       1):
+  dof 14   d  5.88888889e-01
+Node           2 (       2):
+  dof 14   d  5.88888889e-01
+Node           3 (       3):
+  dof 14   d  5.88888889e-01
+Node           4 (       4):
+  dof 14   d  5.88888889e-01
+
+
+
+
+Element output:
+---------------
+element 1 (       1) :
+  GP  1.1  :  state 5.9167e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.2  :  state 5.9167e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.3  :  state 5.9167e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 5.9167e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+
+
+
+==============================================================
+Output for time 5.00000000e+03 
+==============================================================
+Output for domain   1
+
+
+DofManager output:
+------------------
+Node           1 (       1):
+  dof 14   d  5.55555556e-01
+Node           2 (       2):
+  dof 14   d  5.55555556e-01
+Node           3 (       3):
+  dof 14   d  5.55555556e-01
+Node           4 (       4):
+  dof 14   d  5.55555556e-01
+
+
+
+
+Element output:
+---------------
+element 1 (       1) :
+  GP  1.1  :  state 5.7222e-01   flow -0.0000e+00 1.3878e-22 -0.0000e+00
+  GP  1.2  :  state 5.7222e-01   flow -0.0000e+00 1.3878e-22 -0.0000e+00
+  GP  1.3  :  state 5.7222e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 5.7222e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+
+
+
+==============================================================
+Output for time 1.00000000e+04 
+==============================================================
+Output for domain   1
+
+
+DofManager output:
+------------------
+Node           1 (       1):
+  dof 14   d  5.00000000e-01
+Node           2 (       2):
+  dof 14   d  5.00000000e-01
+Node           3 (       3):
+  dof 14   d  5.00000000e-01
+Node           4 (       4):
+  dof 14   d  5.00000000e-01
+
+
+
+
+Element output:
+---------------
+element 1 (       1) :
+  GP  1.1  :  state 5.2778e-01   flow -0.0000e+00 -2.7756e-22 -0.0000e+00
+  GP  1.2  :  state 5.2778e-01   flow -0.0000e+00 -2.7756e-22 -0.0000e+00
+  GP  1.3  :  state 5.2778e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 5.2778e-01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+
+
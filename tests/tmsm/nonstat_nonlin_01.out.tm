@@ -0,0 +1,103 @@
+############################################################## www.oofem.org ###
+       ####    ####   ######  ######  #    #
+     #    #  #    #  #       #       ##  ##
+    #    #  #    #  #####   #####   # ## #
+   #    #  #    #  #       #       #    #
+  #    #  #    #  #       #       #    #   OOFEM ver. 2.6
+  ####    ####   #       ######  #    #    Copyright (C) 1994-2017 Borek Patzak
+################################################################################
+
+
+Starting analysis on: Sun Oct 18 13:04:08 2026
+
+Quadrilateral element subjected to heat flux (Newton b.c)
+
+==============================================================
+Output for time 3.60000000e+03 
+==============================================================
+Output for domain   1
+
+
+DofManager output:
+------------------
+Node           1 (       1):
+  dof 10   d  1.00000000e+01
+Node           2 (       2):
+  dof 10   d  1.00000000e+01
+Node           3 (       3):
+  dof 10   d  1.00000000e+01
+Node           4 (       4):
+  dof 10   d  1.00000000e+01
+
+
+
+
+Element output:
+---------------
+element 1 (       1) :
+  GP  1.1  :  state 5.0000e+00   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.2  :  state 5.0000e+00   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.3  :  state 5.0000e+00   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 5.0000e+00   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+
+
+
+==============================================================
+Output for time 7.20000000e+03 
+==============================================================
+Output for domain   1
+
+
+DofManager output:
+------------------
+Node           1 (       1):
+  dof 10   d  2.00000000e+01
+Node           2 (       2):
+  dof 10   d  2.00000000e+01
+Node           3 (       3):
+  dof 10   d  2.00000000e+01
+Node           4 (       4):
+  dof 10   d  2.00000000e+01
+
+
+
+
+Element output:
+---------------
+element 1 (       1) :
+  GP  1.1  :  state 1.5000e+01   flow -0.0000e+00 -1.0658e-14 -0.0000e+00
+  GP  1.2  :  state 1.5000e+01   flow -0.0000e+00 -1.0658e-14 -0.0000e+00
+  GP  1.3  :  state 1.5000e+01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 1.5000e+01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+
+
+
+==============================================================
+Output for time 1.08000000e+04 
+==============================================================
+Output for domain   1
+
+
+DofManager output:
+------------------
+Node           1 (       1):
+  dof 10   d  3.00000000e+01
+Node           2 (       2):
+  dof 10   d  3.00000000e+01
+Node           3 (       3):
+  dof 10   d  3.00000000e+01
+Node           4 (       4):
+  dof 10   d  3.00000000e+01
+
+
+
+
+Element output:
+---------------
+element 1 (       1) :
+  GP  1.1  :  state 2.5000e+01   flow -0.0000e+00 1.0658e-14 -0.0000e+00
+  GP  1.2  :  state 2.5000e+01   flow -0.0000e+00 1.0658e-14 -0.0000e+00
+  GP  1.3  :  state 2.5000e+01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+  GP  1.4  :  state 2.5000e+01   flow -0.0000e+00 -0.0000e+00 -0.0000e+00
+
+
@@ -0,0 +1,178 @@
+############################################################## www.oofem.org ###
+       ####    ####   ######  ######  #    #
+     #    #  #    #  #       #       ##  ##
+    #    #  #    #  #####   #####   # ## #
+   #    #  #    #  #       #       #    #
+  #    #  #    #  #       #       #    #   OOFEM ver. 2.6
+  ####    ####   #       ######  #    #    Copyright (C) 1994-2017 Borek Patzak
+################################################################################
+
+
+Starting analysis on: Sun Oct 18 13:04:06 2026
+
+Quadrilateral elements subjected to heat flux (Newton b.c)
+
+==============================================================
+Output for time 3.60000000e+04 
+==============================================================
+Output for domain   1
+
+
+DofManager output:
+------------------
+Node           1 (       1):
+  dof 10   d  0.00000000e+00
+Node           2 (       2):
+  dof 10   d  0.00000000e+00
+Node           3 (       3):
+  dof 10   d  0.00000000e+00
+Node           4 (       4):
+  dof 10   d  9.98146959e-01
+Node           5 (       5):
+  dof 10   d  9.98146959e-01
+Node           6 (       6):
+  dof 10   d  9.98146959e-01
+Node           7 (       7):
+  dof 10   d  7.29756332e+01
+Node           8 (       8):
+  dof 10   d  7.29756332e+01
+Node           9 (       9):
+  dof 10   d  7.29756332e+01
+
+
+
+
+Element output:
+---------------
+element 1 (       1) :
+  GP  1.1  :  state 3.9361e-01   flow -3.9968e-15 -7.4861e-01 -0.0000e+00
+  GP  1.2  :  state 1.0547e-01   flow -1.3323e-15 -7.4861e-01 -0.0000e+00
+  GP  1.3  :  state 3.9361e-01   flow -3.9968e-15 -7.4861e-01 -0.0000e+00
+  GP  1.4  :  state 1.0547e-01   flow -1.3323e-15 -7.4861e-01 -0.0000e+00
+element 2 (       2) :
+  GP  1.1  :  state 3.9361e-01   flow 1.9984e-14 -7.4861e-01 -0.0000e+00
+  GP  1.2  :  state 1.0547e-01   flow 5.6621e-15 -7.4861e-01 -0.0000e+00
+  GP  1.3  :  state 3.9361e-01   flow 1.9984e-14 -7.4861e-01 -0.0000e+00
+  GP  1.4  :  state 1.0547e-01   flow 5.6621e-15 -7.4861e-01 -0.0000e+00
+element 3 (       3) :
+  GP  1.1  :  state 2.8883e+01   flow -0.0000e+00 -5.3983e+01 -0.0000e+00
+  GP  1.2  :  state 8.1044e+00   flow -0.0000e+00 -5.3983e+01 -0.0000e+00
+  GP  1.3  :  state 2.8883e+01   flow -0.0000e+00 -5.3983e+01 -0.0000e+00
+  GP  1.4  :  state 8.1044e+00   flow -0.0000e+00 -5.3983e+01 -0.0000e+00
+element 4 (       4) :
+  GP  1.1  :  state 2.8883e+01   flow -8.5265e-14 -5.3983e+01 -0.0000e+00
+  GP  1.2  :  state 8.1044e+00   flow -0.0000e+00 -5.3983e+01 -0.0000e+00
+  GP  1.3  :  state 2.8883e+01   flow -8.5265e-14 -5.3983e+01 -0.0000e+00
+  GP  1.4  :  state 8.1044e+00   flow -0.0000e+00 -5.3983e+01 -0.0000e+00
+
+
+
+==============================================================
+Output for time 7.20000000e+04 
+==============================================================
+Output for domain   1
+
+
+DofManager output:
+------------------
+Node           1 (       1):
+  dof 10   d  0.00000000e+00
+Node           2 (       2):
+  dof 10   d  0.00000000e+00
+Node           3 (       3):
+  dof 10   d  0.00000000e+00
+Node           4 (       4):
+  dof 10   d  3.88482167e+00
+Node           5 (       5):
+  dof 10   d  3.88482167e+00
+Node           6 (       6):
+  dof 10   d  3.88482167e+00
+Node           7 (       7):
+  dof 10   d  1.42064950e+02
+Node           8 (       8):
+  dof 10   d  1.42064950e+02
+Node           9 (       9):
+  dof 10   d  1.42064950e+02
+
+
+
+
+Element output:
+---------------
+element 1 (       1) :
+  GP  1.1  :  state 1.9255e+00   flow 5.3291e-15 -3.6622e+00 -0.0000e+00
+  GP  1.2  :  state 5.1595e-01   flow 1.3323e-15 -3.6622e+00 -0.0000e+00
+  GP  1.3  :  state 1.9255e+00   flow 5.3291e-15 -3.6622e+00 -0.0000e+00
+  GP  1.4  :  state 5.1595e-01   flow 1.3323e-15 -3.6622e+00 -0.0000e+00
+element 2 (       2) :
+  GP  1.1  :  state 1.9255e+00   flow 2.6645e-14 -3.6622e+00 -0.0000e+00
+  GP  1.2  :  state 5.1595e-01   flow 6.6613e-15 -3.6622e+00 -0.0000e+00
+  GP  1.3  :  state 1.9255e+00   flow 2.6645e-14 -3.6622e+00 -0.0000e+00
+  GP  1.4  :  state 5.1595e-01   flow 6.6613e-15 -3.6622e+00 -0.0000e+00
+element 3 (       3) :
+  GP  1.1  :  state 8.5315e+01   flow -0.0000e+00 -1.5762e+02 -0.0000e+00
+  GP  1.2  :  state 2.4647e+01   flow -0.0000e+00 -1.5762e+02 -0.0000e+00
+  GP  1.3  :  state 8.5315e+01   flow -0.0000e+00 -1.5762e+02 -0.0000e+00
+  GP  1.4  :  state 2.4647e+01   flow -0.0000e+00 -1.5762e+02 -0.0000e+00
+element 4 (       4) :
+  GP  1.1  :  state 8.5315e+01   flow -1.7053e-13 -1.5762e+02 -0.0000e+00
+  GP  1.2  :  state 2.4647e+01   flow -0.0000e+00 -1.5762e+02 -0.0000e+00
+  GP  1.3  :  state 8.5315e+01   flow -1.7053e-13 -1.5762e+02 -0.0000e+00
+  GP  1.4  :  state 2.4647e+01   flow -0.0000e+00 -1.5762e+02 -0.0000e+00
+
+
+
+==============================================================
+Output for time 1.08000000e+05 
+==============================================================
+Output for domain   1
+
+
+DofManager output:
+------------------
+Node           1 (       1):
+  dof 10   d  0.00000000e+00
+Node           2 (       2):
+  dof 10   d  0.00000000e+00
+Node           3 (       3):
+  dof 10   d  0.00000000e+00
+Node           4 (       4):
+  dof 10   d  8.45463247e+00
+Node           5 (       5):
+  dof 10   d  8.45463247e+00
+Node           6 (       6):
+  dof 10   d  8.45463247e+00
+Node           7 (       7):
+  dof 10   d  2.07578282e+02
+Node           8 (       8):
+  dof 10   d  2.07578282e+02
+Node           9 (       9):
+  dof 10   d  2.07578282e+02
+
+
+
+
+Element output:
+---------------
+element 1 (       1) :
+  GP  1.1  :  state 4.8659e+00   flow -0.0000e+00 -9.2546e+00 -0.0000e+00
+  GP  1.2  :  state 1.3038e+00   flow -0.0000e+00 -9.2546e+00 -0.0000e+00
+  GP  1.3  :  state 4.8659e+00   flow -0.0000e+00 -9.2546e+00 -0.0000e+00
+  GP  1.4  :  state 1.3038e+00   flow -0.0000e+00 -9.2546e+00 -0.0000e+00
+element 2 (       2) :
+  GP  1.1  :  state 4.8659e+00   flow 4.2633e-14 -9.2546e+00 -0.0000e+00
+  GP  1.2  :  state 1.3038e+00   flow 1.0658e-14 -9.2546e+00 -0.0000e+00
+  GP  1.3  :  state 4.8659e+00   flow 4.2633e-14 -9.2546e+00 -0.0000e+00
+  GP  1.4  :  state 1.3038e+00   flow 1.0658e-14 -9.2546e+00 -0.0000e+00
+element 3 (       3) :
+  GP  1.1  :  state 1.3918e+02   flow -0.0000e+00 -2.5298e+02 -0.0000e+00
+  GP  1.2  :  state 4.1810e+01   flow -0.0000e+00 -2.5298e+02 -0.0000e+00
+  GP  1.3  :  state 1.3918e+02   flow -0.0000e+00 -2.5298e+02 -0.0000e+00
+  GP  1.4  :  state 4.1810e+01   flow -0.0000e+00 -2.5298e+02 -0.0000e+00
+element 4 (       4) :
+  GP  1.1  :  state 1.3918e+02   flow -0.0000e+00 -2.5298e+02 -0.0000e+00
+  GP  1.2  :  state 4.1810e+01   flow 8.5265e-14 -2.5298e+02 -0.0000e+00
+  GP  1.3  :  state 1.3918e+02   flow -0.0000e+00 -2.5298e+02 -0.0000e+00
+  GP  1.4  :  state 4.1810e+01   flow 8.5265e-14 -2.5298e+02 -0.0000e+00
+
+